@@ -70,9 +70,9 @@ void autopick_delayed_alter(PlayerType *player_ptr)
 
     const auto p_pos = player_ptr->get_position();
     auto &grid = player_ptr->current_floor_ptr->get_grid(p_pos);
-    for (auto it = grid.o_idx_list.begin(); it != grid.o_idx_list.end();) {
-        INVENTORY_IDX i_idx = *it++;
-        autopick_delayed_alter_aux(player_ptr, -i_idx);
+    const auto o_idx_list = grid.o_idx_list;
+    for (const auto o_idx : o_idx_list) {
+        autopick_delayed_alter_aux(player_ptr, -o_idx);
     }
 
     // PW_FLOOR_ITEM_LISTは遅れるので即時更新
@@ -101,8 +101,8 @@ void autopick_alter_item(PlayerType *player_ptr, INVENTORY_IDX i_idx, bool destr
  */
 void autopick_pickup_items(PlayerType *player_ptr, Grid *g_ptr)
 {
-    for (auto it = g_ptr->o_idx_list.begin(); it != g_ptr->o_idx_list.end();) {
-        OBJECT_IDX this_o_idx = *it++;
+    const auto o_idx_list = g_ptr->o_idx_list;
+    for (const auto this_o_idx : o_idx_list) {
         auto *o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
         int idx = find_autopick_list(player_ptr, o_ptr);
         auto_inscribe_item(o_ptr, idx);
@@ -12,7 +12,10 @@
 #include "sv-definition/sv-weapon-types.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "world/world.h"
+#include <algorithm>
 #include <array>
+#include <random>
 
 namespace {
 
@@ -29,6 +32,26 @@ constexpr std::array<short, random_distribution> auto_roller_distribution = {
         15, 15, 15, 15, 15, 15, 16, 16, 16, 17 /*50-59*/
     }
 };
+
+constexpr auto min_stat_value = 8;
+constexpr auto max_stat_value = 17;
+constexpr auto min_stat_sum = 42 + 5 * 6 + 1; //!< get_stats() が受理する能力値合計の下限
+constexpr auto max_stat_sum = 57 + 5 * 6 - 1; //!< get_stats() が受理する能力値合計の上限
+
+/*!
+ * @brief 能力値毎の出現パターン数 (auto_roller_distribution の60個のうち、その値になる個数)
+ */
+constexpr std::array<uint64_t, max_stat_value + 1> make_stat_patterns()
+{
+    std::array<uint64_t, max_stat_value + 1> patterns{};
+    for (const auto value : auto_roller_distribution) {
+        patterns[value]++;
+    }
+
+    return patterns;
+}
+
+constexpr auto stat_patterns = make_stat_patterns();
 }
 
 /*!
@@ -90,6 +113,68 @@ void get_stats(PlayerType *player_ptr)
     }
 }
 
+/*!
+ * @brief オートローラの下限値 (stat_limit) を満たす能力値を直接ロールする
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @return 下限値を満たす組み合わせが存在しなければfalse (能力値は変更しない)
+ * @details
+ * get_stats() を下限値を満たすまで繰り返した場合と同じ分布になるよう、
+ * 残りの能力値で取りうる合計値毎のパターン数を動的計画法で数え、
+ * 先頭の能力値から順にパターン数で重み付けして決めていく.
+ */
+bool get_stats_within_limits(PlayerType *player_ptr)
+{
+    constexpr auto max_sum = max_stat_value * A_MAX;
+
+    /* ways[i][s]: i番目以降の能力値の合計がsになるパターン数 */
+    std::array<std::array<uint64_t, max_sum + 1>, A_MAX + 1> ways{};
+    ways[A_MAX][0] = 1;
+    for (int i = A_MAX - 1; i >= 0; i--) {
+        const auto lower = std::max<int>(min_stat_value, stat_limit[i]);
+        for (auto value = lower; value <= max_stat_value; value++) {
+            for (auto sum = 0; sum + value <= max_sum; sum++) {
+                ways[i][sum + value] += stat_patterns[value] * ways[i + 1][sum];
+            }
+        }
+    }
+
+    const auto count_ways = [&ways](int i, int sum_so_far) {
+        uint64_t count = 0;
+        for (auto sum = std::max(min_stat_sum - sum_so_far, 0); sum <= max_stat_sum - sum_so_far; sum++) {
+            count += ways[i][sum];
+        }
+
+        return count;
+    };
+
+    if (count_ways(0, 0) == 0) {
+        return false;
+    }
+
+    auto sum_so_far = 0;
+    for (int i = 0; i < A_MAX; i++) {
+        const auto lower = std::max<int>(min_stat_value, stat_limit[i]);
+        std::array<uint64_t, max_stat_value + 1> weights{};
+        uint64_t total = 0;
+        for (auto value = lower; value <= max_stat_value; value++) {
+            weights[value] = stat_patterns[value] * count_ways(i + 1, sum_so_far + value);
+            total += weights[value];
+        }
+
+        auto roll = std::uniform_int_distribution<uint64_t>(0, total - 1)(w_ptr->rng);
+        auto value = lower;
+        while (roll >= weights[value]) {
+            roll -= weights[value];
+            value++;
+        }
+
+        sum_so_far += value;
+        player_ptr->stat_cur[i] = player_ptr->stat_max[i] = static_cast<short>(value);
+    }
+
+    return true;
+}
+
 /*!
  * @brief 経験値修正の合計値を計算
  */
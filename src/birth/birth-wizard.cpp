@@ -423,7 +423,10 @@ static bool display_auto_roller_count(PlayerType *player_ptr, const int col)
 static void exe_auto_roller(PlayerType *player_ptr, chara_limit_type chara_limit, const int col)
 {
     while (autoroller || autochara) {
-        get_stats(player_ptr);
+        if (!autoroller || !get_stats_within_limits(player_ptr)) {
+            get_stats(player_ptr);
+        }
+
         auto_round++;
         auto_roller_count();
         bool accept = decide_initial_stat(player_ptr);
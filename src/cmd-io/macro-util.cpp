@@ -1,4 +1,6 @@
 #include "cmd-io/macro-util.h"
+#include <string_view>
+#include <unordered_map>
 
 /* Current macro action [1024] */
 std::vector<char> macro_buffers;
@@ -15,25 +17,83 @@ int16_t active_macros;
 /* Expand macros in "get_com" or not */
 bool get_com_no_macros = false;
 
-/* Determine if any macros have ever started with a given character */
-static bool macro_uses[256];
+namespace {
+/*!
+ * @brief マクロのトリガー文字列を格納するトライ木の節
+ */
+struct MacroTrieNode {
+    std::unordered_map<char, int> children{}; //!< 次の1文字から子の節の添字への対応
+    int macro_idx = -1; //!< この節で終わるマクロの添字
+    int first_in_subtree = -1; //!< この節以下 (自身を含む) で終わるマクロの最小の添字
+    int first_below = -1; //!< この節より下 (自身を含まない) で終わるマクロの最小の添字
+};
+
+/*!
+ * @brief マクロのトリガー文字列のトライ木. 先頭要素が根 (空文字列)
+ * @details マクロは削除されず、添字は追加順に単調増加するので、各節の最小添字は最初に登録された値のまま変わらない.
+ */
+std::vector<MacroTrieNode> macro_trie(1);
 
-/* Find the macro (if any) which exactly matches the given pattern */
-int macro_find_exact(concptr pat)
+int find_child(int node, char ch)
 {
-    if (!macro_uses[(byte)(pat[0])]) {
-        return -1;
+    const auto &children = macro_trie[node].children;
+    const auto it = children.find(ch);
+    return it == children.end() ? -1 : it->second;
+}
+
+/*!
+ * @brief パターン文字列に対応する節を探す
+ * @return 対応する節の添字. 該当するマクロが1つもなければ-1
+ */
+int find_node(std::string_view pat)
+{
+    auto node = 0;
+    for (const auto ch : pat) {
+        node = find_child(node, ch);
+        if (node < 0) {
+            return -1;
+        }
     }
 
-    for (int i = 0; i < active_macros; ++i) {
-        if (!streq(macro_patterns[i], pat)) {
-            continue;
+    return node;
+}
+
+void add_to_trie(std::string_view pat, int macro_idx)
+{
+    auto node = 0;
+    for (const auto ch : pat) {
+        auto &first_below = macro_trie[node].first_below;
+        if (first_below < 0) {
+            first_below = macro_idx;
+        }
+
+        if (macro_trie[node].first_in_subtree < 0) {
+            macro_trie[node].first_in_subtree = macro_idx;
         }
 
-        return i;
+        auto child = find_child(node, ch);
+        if (child < 0) {
+            child = static_cast<int>(macro_trie.size());
+            macro_trie[node].children.emplace(ch, child);
+            macro_trie.emplace_back();
+        }
+
+        node = child;
     }
 
-    return -1;
+    auto &leaf = macro_trie[node];
+    leaf.macro_idx = macro_idx;
+    if (leaf.first_in_subtree < 0) {
+        leaf.first_in_subtree = macro_idx;
+    }
+}
+}
+
+/* Find the macro (if any) which exactly matches the given pattern */
+int macro_find_exact(concptr pat)
+{
+    const auto node = find_node(pat);
+    return node < 0 ? -1 : macro_trie[node].macro_idx;
 }
 
 /*
@@ -41,19 +101,8 @@ int macro_find_exact(concptr pat)
  */
 int macro_find_check(concptr pat)
 {
-    if (!macro_uses[(byte)(pat[0])]) {
-        return -1;
-    }
-
-    for (int i = 0; i < active_macros; ++i) {
-        if (!prefix(macro_patterns[i], pat)) {
-            continue;
-        }
-
-        return i;
-    }
-
-    return -1;
+    const auto node = find_node(pat);
+    return node < 0 ? -1 : macro_trie[node].first_in_subtree;
 }
 
 /*
@@ -61,50 +110,71 @@ int macro_find_check(concptr pat)
  */
 int macro_find_maybe(concptr pat)
 {
-    if (!macro_uses[(byte)(pat[0])]) {
-        return -1;
-    }
+    const auto node = find_node(pat);
+    return node < 0 ? -1 : macro_trie[node].first_below;
+}
 
-    for (int i = 0; i < active_macros; ++i) {
-        if (!prefix(macro_patterns[i], pat)) {
-            continue;
-        }
-        if (streq(macro_patterns[i], pat)) {
-            continue;
+/*
+ * Find the longest macro (if any) which starts with the given pattern
+ */
+int macro_find_ready(concptr pat)
+{
+    MacroTriggerCursor cursor;
+    for (auto p = pat; *p != '\0'; p++) {
+        if (!cursor.advance(*p)) {
+            break;
         }
-
-        return i;
     }
 
-    return -1;
+    return cursor.find_ready();
 }
 
-/*
- * Find the longest macro (if any) which starts with the given pattern
+/*!
+ * @brief トリガー文字列を1文字進める
+ * @param ch 追加する文字
+ * @return 追加後の文字列で始まるマクロがあればtrue
+ * @details 一度照合に失敗した後は何を追加しても false を返し、find_ready() はそれまでの結果を保つ.
  */
-int macro_find_ready(concptr pat)
+bool MacroTriggerCursor::advance(char ch)
 {
-    int t, n = -1, s = -1;
+    if (this->node < 0) {
+        return false;
+    }
 
-    if (!macro_uses[(byte)(pat[0])]) {
-        return -1;
+    this->node = find_child(this->node, ch);
+    if (this->node < 0) {
+        return false;
     }
 
-    for (int i = 0; i < active_macros; ++i) {
-        if (!prefix(pat, macro_patterns[i])) {
-            continue;
-        }
+    if (macro_trie[this->node].macro_idx >= 0) {
+        this->ready = macro_trie[this->node].macro_idx;
+    }
 
-        t = macro_patterns[i].size();
-        if ((n >= 0) && (s > t)) {
-            continue;
-        }
+    return true;
+}
 
-        n = i;
-        s = t;
-    }
+/*!
+ * @brief これまでの文字列で始まる最初のマクロ (macro_find_check() 相当)
+ */
+int MacroTriggerCursor::find_check() const
+{
+    return this->node < 0 ? -1 : macro_trie[this->node].first_in_subtree;
+}
 
-    return n;
+/*!
+ * @brief これまでの文字列で始まり、より長い最初のマクロ (macro_find_maybe() 相当)
+ */
+int MacroTriggerCursor::find_maybe() const
+{
+    return this->node < 0 ? -1 : macro_trie[this->node].first_below;
+}
+
+/*!
+ * @brief これまでの文字列の先頭に一致する最長のマクロ (macro_find_ready() 相当)
+ */
+int MacroTriggerCursor::find_ready() const
+{
+    return this->ready;
 }
 
 /*
@@ -134,9 +204,9 @@ errr macro_add(concptr pat, concptr act)
     if (n < 0) {
         n = active_macros++;
         macro_patterns[n] = pat;
+        add_to_trie(pat, n);
     }
 
     macro_actions[n] = act;
-    macro_uses[(byte)(pat[0])] = true;
     return 0;
 }
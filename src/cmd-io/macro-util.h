@@ -18,3 +18,19 @@ int macro_find_check(concptr pat);
 errr macro_add(concptr pat, concptr act);
 int macro_find_maybe(concptr pat);
 int macro_find_ready(concptr pat);
+
+/*!
+ * @brief マクロのトリガー文字列を1文字ずつ照合する
+ * @details 入力キーが届く度に advance() を呼べば、文字列全体を照合し直さずに macro_find_*() と同じ結果が得られる.
+ */
+class MacroTriggerCursor {
+public:
+    bool advance(char ch);
+    int find_check() const;
+    int find_maybe() const;
+    int find_ready() const;
+
+private:
+    int node = 0; //!< 照合中のトライ木の節. 照合に失敗したら-1
+    int ready = -1; //!< これまでに完全一致した最長のマクロ
+};
@@ -177,7 +177,7 @@ void do_cmd_player_status(PlayerType *player_ptr)
  */
 void do_cmd_message_one(void)
 {
-    prt(format("> %s", message_str(0)->data()), 0, 0);
+    prt(format("> %s", message_str(0).data()), 0, 0);
 }
 
 /*!
@@ -216,7 +216,7 @@ void do_cmd_messages(int num_now)
         int skey;
         for (j = 0; (j < num_lines) && (i + j < n); j++) {
             const auto msg_str = message_str(i + j);
-            const auto *msg = msg_str->data();
+            const auto *msg = msg_str.data();
             c_prt((i + j < num_now ? TERM_WHITE : TERM_SLATE), msg, num_lines + 1 - j, 0);
             if (shower.empty()) {
                 continue;
@@ -277,7 +277,7 @@ void do_cmd_messages(int num_now)
             for (int z = i + 1; z < n; z++) {
                 // @details ダメ文字対策でstringを使わない.
                 const auto msg = message_str(z);
-                if (str_find(*msg, finder_str)) {
+                if (angband_strstr(msg.data(), finder_str) != nullptr) {
                     i = z;
                     break;
                 }
@@ -33,6 +33,8 @@ static void compact_objects_aux(FloorType *floor_ptr, OBJECT_IDX i1, OBJECT_IDX
     // 要素番号i1のオブジェクトを要素番号i2に移動
     floor_ptr->o_list[i2] = floor_ptr->o_list[i1];
     o_ptr->wipe();
+    floor_ptr->invalidate_item_feeling(i1);
+    floor_ptr->invalidate_item_feeling(i2);
 }
 
 /*!
@@ -118,4 +120,6 @@ void compact_objects(PlayerType *player_ptr, int size)
         compact_objects_aux(floor_ptr, floor_ptr->o_max - 1, i);
         floor_ptr->o_max--;
     }
+
+    floor_ptr->o_free_list.clear();
 }
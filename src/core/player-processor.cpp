@@ -55,6 +55,7 @@
 #include "system/monster-race-info.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 #include "term/screen-processor.h"
 #include "timed-effect/player-blindness.h"
 #include "timed-effect/player-confusion.h"
@@ -115,6 +116,7 @@ bool continuous_action_running(PlayerType *player_ptr)
  */
 void process_player(PlayerType *player_ptr)
 {
+    TurnProfileScope profile_scope(TurnPhase::PROCESS_PLAYER);
     if (player_ptr->hack_mutation) {
         msg_print(_("何か変わった気がする！", "You feel different!"));
         (void)gain_mutation(player_ptr, 0);
@@ -443,6 +445,7 @@ void process_player(PlayerType *player_ptr)
  */
 void process_upkeep_with_speed(PlayerType *player_ptr)
 {
+    TurnProfileScope profile_scope(TurnPhase::PROCESS_UPKEEP);
     if (!load && player_ptr->enchant_energy_need > 0 && !player_ptr->leaving) {
         player_ptr->enchant_energy_need -= speed_to_energy(player_ptr->pspeed);
     }
@@ -3,6 +3,7 @@
 #include "player/player-status.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 
 /*!
  * @brief 全更新処理をチェックして処理していく
@@ -11,14 +12,17 @@ void handle_stuff(PlayerType *player_ptr)
 {
     auto &rfu = RedrawingFlagsUpdater::get_instance();
     if (rfu.any_stats()) {
+        TurnProfileScope profile_scope(TurnPhase::UPDATE_CREATURE);
         update_creature(player_ptr);
     }
 
     if (rfu.any_main()) {
+        TurnProfileScope profile_scope(TurnPhase::REDRAW_STUFF);
         redraw_stuff(player_ptr);
     }
 
     if (rfu.any_sub()) {
+        TurnProfileScope profile_scope(TurnPhase::WINDOW_STUFF);
         window_stuff(player_ptr);
     }
 }
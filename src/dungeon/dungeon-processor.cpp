@@ -38,6 +38,7 @@
 #include "system/monster-race-info.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 #include "target/target-checker.h"
 #include "util/bit-flags-calculator.h"
 #include "view/display-messages.h"
@@ -217,18 +218,10 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
             compact_monsters(player_ptr, 64);
         }
 
-        if ((floor.m_cnt + 32 < floor.m_max) && !is_watching) {
-            compact_monsters(player_ptr, 0);
-        }
-
         if (floor.o_cnt + 32 > w_ptr->max_o_idx) {
             compact_objects(player_ptr, 64);
         }
 
-        if (floor.o_cnt + 32 < floor.o_max) {
-            compact_objects(player_ptr, 0);
-        }
-
         process_player(player_ptr);
         process_upkeep_with_speed(player_ptr);
         handle_stuff(player_ptr);
@@ -267,6 +260,7 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
         }
 
         w_ptr->game_turn++;
+        TurnProfiler::get_instance().count_turn();
         if (w_ptr->dungeon_turn < w_ptr->dungeon_turn_limit) {
             if (!player_ptr->wild_mode || wild_regen) {
                 w_ptr->dungeon_turn++;
@@ -21,6 +21,7 @@
 #include "system/player-type-definition.h"
 #include "util/bit-flags-calculator.h"
 #include "view/display-messages.h"
+#include <algorithm>
 #include <set>
 
 /*!
@@ -45,13 +46,15 @@ bool affect_item(PlayerType *player_ptr, MONSTER_IDX who, POSITION r, POSITION y
     who = who ? who : 0;
     dam = (dam + r) / (r + 1);
     std::set<OBJECT_IDX> processed_list;
-    for (auto it = grid.o_idx_list.begin(); it != grid.o_idx_list.end();) {
-        const OBJECT_IDX this_o_idx = *it++;
-
-        if (auto pit = processed_list.find(this_o_idx); pit != processed_list.end()) {
-            continue;
+    const auto is_unprocessed = [&processed_list](OBJECT_IDX o_idx) { return !processed_list.contains(o_idx); };
+    while (true) {
+        // 薬の破壊効果によりリスト中の他のアイテムが破壊されることがあるので、毎回リストの先頭から未処理のアイテムを探す
+        const auto it = std::find_if(grid.o_idx_list.begin(), grid.o_idx_list.end(), is_unprocessed);
+        if (it == grid.o_idx_list.end()) {
+            break;
         }
 
+        const OBJECT_IDX this_o_idx = *it;
         processed_list.insert(this_o_idx);
 
         auto *o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
@@ -199,6 +202,7 @@ bool affect_item(PlayerType *player_ptr, MONSTER_IDX who, POSITION r, POSITION y
         }
         case AttributeType::IDENTIFY: {
             identify_item(player_ptr, o_ptr);
+            player_ptr->current_floor_ptr->invalidate_item_feeling(this_o_idx);
             autopick_alter_item(player_ptr, (-this_o_idx), false);
             break;
         }
@@ -282,10 +286,6 @@ bool affect_item(PlayerType *player_ptr, MONSTER_IDX who, POSITION r, POSITION y
         delete_object_idx(player_ptr, this_o_idx);
         if (is_potion) {
             (void)potion_smash_effect(player_ptr, who, y, x, bi_id);
-
-            // 薬の破壊効果によりリストの次のアイテムが破壊された可能性があるのでリストの最初から処理をやり直す
-            // 処理済みのアイテムは processed_list に登録されており、スキップされる
-            it = grid.o_idx_list.begin();
         }
 
         lite_spot(player_ptr, y, x);
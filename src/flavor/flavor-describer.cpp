@@ -34,6 +34,7 @@
 #include "system/floor-type-definition.h"
 #include "system/item-entity.h"
 #include "system/player-type-definition.h"
+#include "term/z-form.h"
 #include "util/bit-flags-calculator.h"
 #include "util/string-processor.h"
 #include <sstream>
@@ -159,7 +160,7 @@ static std::string describe_bow_power(PlayerType *player_ptr, const ItemEntity &
     }
 
     std::stringstream ss;
-    ss << format(" (x%d)", power);
+    ss << FormatBuffer(" (x%d)", power).data();
 
     auto num_fire = 100;
     if (none_bits(opt.mode, OD_DEBUG)) {
@@ -175,7 +176,7 @@ static std::string describe_bow_power(PlayerType *player_ptr, const ItemEntity &
     }
 
     const auto fire_rate = item.get_bow_energy() / num_fire;
-    ss << format(" (%d.%dturn)", fire_rate / 100, fire_rate % 100);
+    ss << FormatBuffer(" (%d.%dturn)", fire_rate / 100, fire_rate % 100).data();
 
     return ss.str();
 }
@@ -239,7 +240,7 @@ static std::string describe_fire_energy(PlayerType *player_ptr, const ItemEntity
     const auto bow_bonus = bow.is_known() ? bow.to_h : 0;
     const auto percent = calc_crit_ratio_shot(player_ptr, ammo_bonus, bow_bonus);
 
-    ss << format("/%d.%02d%s", percent / 100, percent % 100, show_ammo_detail ? "% crit" : "%");
+    ss << FormatBuffer("/%d.%02d%s", percent / 100, percent % 100, show_ammo_detail ? "% crit" : "%").data();
 
     return ss.str();
 }
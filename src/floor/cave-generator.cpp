@@ -427,9 +427,7 @@ bool cave_gen(PlayerType *player_ptr, concptr *why)
     dd_ptr->row_rooms = floor_ptr->height / BLOCK_HGT;
     dd_ptr->col_rooms = floor_ptr->width / BLOCK_WID;
     for (POSITION y = 0; y < dd_ptr->row_rooms; y++) {
-        for (POSITION x = 0; x < dd_ptr->col_rooms; x++) {
-            dd_ptr->room_map[y][x] = false;
-        }
+        dd_ptr->room_map[y] = 0;
     }
 
     dd_ptr->cent_n = 0;
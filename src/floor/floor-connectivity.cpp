@@ -0,0 +1,154 @@
+/*!
+ * @brief フロアの連結性の判定
+ */
+#include "floor/floor-connectivity.h"
+#include "floor/geometry.h"
+#include "system/floor-type-definition.h"
+#include "system/grid-type-definition.h"
+#include "system/terrain-type-definition.h"
+#include <utility>
+
+/*!
+ * @brief フロアを1度走査して連結成分を求める
+ * @param floor フロアへの参照
+ * @details 走査済みの近傍 (左、左上、上、右上) とのみ併合すれば全ての隣接関係を網羅できる.
+ */
+FloorConnectivity::FloorConnectivity(const FloorType &floor)
+    : floor(floor)
+    , width(floor.width)
+    , parents(floor.height * floor.width, BLOCKED)
+    , sizes(floor.height * floor.width, 1)
+{
+    for (auto y = 0; y < floor.height; y++) {
+        for (auto x = 0; x < floor.width; x++) {
+            const Pos2D pos(y, x);
+            if (this->is_blocker(pos)) {
+                continue;
+            }
+
+            const auto idx = y * this->width + x;
+            this->parents[idx] = idx;
+            this->num_components++;
+            this->connect_neighbors(pos, true);
+        }
+    }
+}
+
+/*!
+ * @brief フロアが連結かどうかを返す
+ * @return 連結成分がちょうど1つならtrue (通れるマスが1つもない場合はfalse)
+ */
+bool FloorConnectivity::is_connected() const
+{
+    return this->num_components == 1;
+}
+
+/*!
+ * @brief 別々の連結成分に接する永久地形を探す
+ * @return 通れるようにすれば連結成分が減るマスの座標. 見つからなければnullopt
+ * @details フロア外周と、Vaultの一部であるマスは候補から除く.
+ */
+std::optional<Pos2D> FloorConnectivity::find_bridge() const
+{
+    for (auto y = 1; y < this->floor.height - 1; y++) {
+        for (auto x = 1; x < this->floor.width - 1; x++) {
+            const Pos2D pos(y, x);
+            if ((this->parents[y * this->width + x] != BLOCKED) || this->floor.get_grid(pos).is_icky()) {
+                continue;
+            }
+
+            auto root = BLOCKED;
+            for (auto i = 0; i < 8; i++) {
+                const auto idx = (y + ddy_ddd[i]) * this->width + x + ddx_ddd[i];
+                if (this->parents[idx] == BLOCKED) {
+                    continue;
+                }
+
+                const auto neighbor_root = this->find_root(idx);
+                if (root == BLOCKED) {
+                    root = neighbor_root;
+                } else if (root != neighbor_root) {
+                    return pos;
+                }
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+/*!
+ * @brief 通れるようになったマスを連結成分に加える
+ * @param pos 通れるようになったマスの座標
+ */
+void FloorConnectivity::open(const Pos2D &pos)
+{
+    const auto idx = pos.y * this->width + pos.x;
+    if ((this->parents[idx] != BLOCKED) || this->is_blocker(pos)) {
+        return;
+    }
+
+    this->parents[idx] = idx;
+    this->num_components++;
+    this->connect_neighbors(pos, false);
+}
+
+bool FloorConnectivity::is_blocker(const Pos2D &pos) const
+{
+    const auto &flags = this->floor.get_grid(pos).get_terrain().flags;
+    return flags.has(TerrainCharacteristics::PERMANENT) && flags.has_not(TerrainCharacteristics::MOVE);
+}
+
+/*!
+ * @details 大きい方の成分に併合するため木の高さは要素数の対数で抑えられ、経路圧縮をせずとも十分に浅い.
+ */
+int FloorConnectivity::find_root(int idx) const
+{
+    while (this->parents[idx] != idx) {
+        idx = this->parents[idx];
+    }
+
+    return idx;
+}
+
+void FloorConnectivity::unite(int idx1, int idx2)
+{
+    auto root1 = this->find_root(idx1);
+    auto root2 = this->find_root(idx2);
+    if (root1 == root2) {
+        return;
+    }
+
+    if (this->sizes[root1] < this->sizes[root2]) {
+        std::swap(root1, root2);
+    }
+
+    this->parents[root2] = root1;
+    this->sizes[root1] += this->sizes[root2];
+    this->num_components--;
+}
+
+/*!
+ * @brief 通れる近傍マスと同じ連結成分にする
+ * @param pos 中心のマスの座標
+ * @param only_scanned 構築中の走査で既に処理した近傍のみを対象にするか
+ */
+void FloorConnectivity::connect_neighbors(const Pos2D &pos, bool only_scanned)
+{
+    const auto idx = pos.y * this->width + pos.x;
+    for (auto i = 0; i < 8; i++) {
+        const Pos2D pos_neighbor(pos.y + ddy_ddd[i], pos.x + ddx_ddd[i]);
+        if (only_scanned && ((pos_neighbor.y > pos.y) || ((pos_neighbor.y == pos.y) && (pos_neighbor.x > pos.x)))) {
+            continue;
+        }
+
+        if ((pos_neighbor.y < 0) || (pos_neighbor.y >= this->floor.height) || (pos_neighbor.x < 0) || (pos_neighbor.x >= this->width)) {
+            continue;
+        }
+
+        const auto idx_neighbor = pos_neighbor.y * this->width + pos_neighbor.x;
+        if (this->parents[idx_neighbor] != BLOCKED) {
+            this->unite(idx, idx_neighbor);
+        }
+    }
+}
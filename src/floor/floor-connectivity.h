@@ -0,0 +1,35 @@
+#pragma once
+
+#include "util/point-2d.h"
+#include <optional>
+#include <vector>
+
+class FloorType;
+
+/*!
+ * @brief プレイヤーが通れない永久地形で区切られたフロアの連結成分を管理する
+ * @details 各マスの8近傍は互いに移動可能とし、素集合森 (union-find) で連結成分を求める.
+ * 構築はフロアを1度走査するだけで済み、通れるようになったマスは open() で差分のみを反映できる.
+ */
+class FloorConnectivity {
+public:
+    explicit FloorConnectivity(const FloorType &floor);
+
+    bool is_connected() const;
+    std::optional<Pos2D> find_bridge() const;
+    void open(const Pos2D &pos);
+
+private:
+    static constexpr auto BLOCKED = -1; //!< 通れないマスの親
+
+    const FloorType &floor;
+    int width;
+    std::vector<int> parents; //!< 親のマス番号 (根は自身を指す)
+    std::vector<int> sizes; //!< 根毎の成分の大きさ
+    int num_components = 0;
+
+    bool is_blocker(const Pos2D &pos) const;
+    int find_root(int idx) const;
+    void unite(int idx1, int idx2);
+    void connect_neighbors(const Pos2D &pos, bool only_scanned);
+};
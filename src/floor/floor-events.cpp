@@ -5,6 +5,7 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/quest.h"
 #include "floor/cave.h"
+#include "floor/floor-traversal.h"
 #include "floor/geometry.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-options.h"
@@ -127,6 +128,119 @@ static int rating_boost(int delta)
     return delta * delta + 50 * delta;
 }
 
+/*!
+ * @brief アーティファクトであることを除いた、アイテム1つ分の雰囲気の評価値を算出する
+ * @param floor フロアへの参照
+ * @param item 評価するアイテム
+ * @return 評価値
+ */
+static int calc_item_rating(const FloorType &floor, const ItemEntity &item)
+{
+    const int base = 10;
+    int delta = 0;
+    if (item.is_ego()) {
+        const auto &ego = item.get_ego();
+        delta += ego.rating * base;
+    }
+
+    if (item.bi_key.tval() == ItemKindType::DRAG_ARMOR) {
+        delta += 30 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::SHIELD, SV_DRAGON_SHIELD)) {
+        delta += 5 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::GLOVES, SV_SET_OF_DRAGON_GLOVES)) {
+        delta += 5 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::BOOTS, SV_PAIR_OF_DRAGON_GREAVE)) {
+        delta += 5 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::HELM, SV_DRAGON_HELM)) {
+        delta += 5 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::RING, SV_RING_SPEED) && !item.is_cursed()) {
+        delta += 25 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::RING, SV_RING_LORDLY) && !item.is_cursed()) {
+        delta += 15 * base;
+    }
+
+    if (item.bi_key == BaseitemKey(ItemKindType::AMULET, SV_AMULET_THE_MAGI) && !item.is_cursed()) {
+        delta += 15 * base;
+    }
+
+    const auto &baseitem = item.get_baseitem();
+    if (!item.is_cursed() && !item.is_broken() && baseitem.level > floor.dun_level) {
+        delta += (baseitem.level - floor.dun_level) * base;
+    }
+
+    return delta;
+}
+
+/*!
+ * @brief アイテム1つ分のダンジョンの雰囲気への寄与を算出する
+ * @param floor フロアへの参照
+ * @param item 評価するアイテム
+ * @return 寄与 (感知済、または鑑定済で触れたことのあるアイテムは数えない)
+ */
+static ItemFeelingRating calc_item_feeling(const FloorType &floor, const ItemEntity &item)
+{
+    if (!item.is_valid() || (item.is_known() && item.marked.has(OmType::TOUCHED)) || ((item.ident & IDENT_SENSE) != 0)) {
+        return {};
+    }
+
+    const int base = 10;
+    ItemFeelingRating feeling;
+    int delta = 0;
+    if (item.is_fixed_or_random_artifact()) {
+        PRICE cost = object_value_real(&item);
+        delta += 10 * base;
+        if (cost > 10000L) {
+            delta += 10 * base;
+        }
+
+        if (cost > 50000L) {
+            delta += 10 * base;
+        }
+
+        if (cost > 100000L) {
+            delta += 10 * base;
+        }
+
+        feeling.is_artifact = true;
+    }
+
+    delta += calc_item_rating(floor, item);
+    feeling.rating = rating_boost(delta);
+    return feeling;
+}
+
+/*!
+ * @brief 生成・削除・変化したアイテムのダンジョンの雰囲気への寄与を求め直し、合計に反映する
+ * @param floor フロアへの参照
+ * @details 雰囲気の算出の度に全アイテムを評価し直す代わりに、FloorType::invalidate_item_feeling() で
+ * 無効化されたアイテムのみを評価する.
+ */
+static void refresh_item_feelings(FloorType &floor)
+{
+    for (const auto o_idx : floor.o_feeling_stale_list) {
+        auto &feeling = floor.o_feeling_list[o_idx];
+        floor.item_feeling_rating -= feeling.rating;
+        floor.num_feeling_artifacts -= feeling.is_artifact ? 1 : 0;
+        feeling = calc_item_feeling(floor, floor.o_list[o_idx]);
+        floor.item_feeling_rating += feeling.rating;
+        floor.num_feeling_artifacts += feeling.is_artifact ? 1 : 0;
+    }
+
+    floor.o_feeling_stale_list.clear();
+}
+
 /*!
  * @brief ダンジョンの雰囲気を算出する。
  * / Examine all monsters and unidentified objects, and get the feeling of current dungeon floor
@@ -169,78 +283,13 @@ static byte get_dungeon_feeling(PlayerType *player_ptr)
         rating += rating_boost(delta);
     }
 
-    for (MONSTER_IDX i = 1; i < floor_ptr->o_max; i++) {
-        auto *o_ptr = &floor_ptr->o_list[i];
-        int delta = 0;
-        if (!o_ptr->is_valid() || (o_ptr->is_known() && o_ptr->marked.has(OmType::TOUCHED)) || ((o_ptr->ident & IDENT_SENSE) != 0)) {
-            continue;
-        }
-
-        if (o_ptr->is_ego()) {
-            const auto &ego = o_ptr->get_ego();
-            delta += ego.rating * base;
-        }
-
-        if (o_ptr->is_fixed_or_random_artifact()) {
-            PRICE cost = object_value_real(o_ptr);
-            delta += 10 * base;
-            if (cost > 10000L) {
-                delta += 10 * base;
-            }
-
-            if (cost > 50000L) {
-                delta += 10 * base;
-            }
-
-            if (cost > 100000L) {
-                delta += 10 * base;
-            }
-
-            if (!preserve_mode) {
-                return 1;
-            }
-        }
-
-        if (o_ptr->bi_key.tval() == ItemKindType::DRAG_ARMOR) {
-            delta += 30 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::SHIELD, SV_DRAGON_SHIELD)) {
-            delta += 5 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::GLOVES, SV_SET_OF_DRAGON_GLOVES)) {
-            delta += 5 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::BOOTS, SV_PAIR_OF_DRAGON_GREAVE)) {
-            delta += 5 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::HELM, SV_DRAGON_HELM)) {
-            delta += 5 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::RING, SV_RING_SPEED) && !o_ptr->is_cursed()) {
-            delta += 25 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::RING, SV_RING_LORDLY) && !o_ptr->is_cursed()) {
-            delta += 15 * base;
-        }
-
-        if (o_ptr->bi_key == BaseitemKey(ItemKindType::AMULET, SV_AMULET_THE_MAGI) && !o_ptr->is_cursed()) {
-            delta += 15 * base;
-        }
-
-        const auto &baseitem = o_ptr->get_baseitem();
-        if (!o_ptr->is_cursed() && !o_ptr->is_broken() && baseitem.level > floor_ptr->dun_level) {
-            delta += (baseitem.level - floor_ptr->dun_level) * base;
-        }
-
-        rating += rating_boost(delta);
+    refresh_item_feelings(*floor_ptr);
+    if (!preserve_mode && (floor_ptr->num_feeling_artifacts > 0)) {
+        return 1;
     }
 
+    rating += floor_ptr->item_feeling_rating;
+
     if (rating > rating_boost(1000)) {
         return 2;
     }
@@ -334,23 +383,20 @@ void glow_deep_lava_and_bldg(PlayerType *player_ptr)
         return;
     }
 
-    for (auto y = 0; y < floor.height; y++) {
-        for (auto x = 0; x < floor.width; x++) {
-            const auto &grid = floor.get_grid({ y, x });
-            if (grid.get_terrain_mimic().flags.has_not(TerrainCharacteristics::GLOW)) {
+    for_each_grid(floor, [&floor](const Grid &grid, const Pos2D &pos_center) {
+        if (grid.get_terrain_mimic().flags.has_not(TerrainCharacteristics::GLOW)) {
+            return;
+        }
+
+        for (auto i = 0; i < 9; i++) {
+            const Pos2D pos(pos_center.y + ddy_ddd[i], pos_center.x + ddx_ddd[i]);
+            if (!in_bounds2(&floor, pos.y, pos.x)) {
                 continue;
             }
 
-            for (auto i = 0; i < 9; i++) {
-                const Pos2D pos(y + ddy_ddd[i], x + ddx_ddd[i]);
-                if (!in_bounds2(&floor, pos.y, pos.x)) {
-                    continue;
-                }
-
-                floor.get_grid(pos).info |= CAVE_GLOW;
-            }
+            floor.get_grid(pos).info |= CAVE_GLOW;
         }
-    }
+    });
 
     auto &rfu = RedrawingFlagsUpdater::get_instance();
     static constexpr auto flags_srf = {
@@ -13,9 +13,11 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/quest.h"
 #include "floor/cave-generator.h"
+#include "floor/floor-connectivity.h"
 #include "floor/floor-events.h"
 #include "floor/floor-generator.h"
 #include "floor/floor-save.h" //!< @todo precalc_cur_num_of_pet() が依存している、違和感.
+#include "floor/floor-traversal.h"
 #include "floor/floor-util.h"
 #include "floor/wild.h"
 #include "game-option/birth-options.h"
@@ -55,7 +57,6 @@
 #include "world/world.h"
 #include <algorithm>
 #include <array>
-#include <stack>
 
 /*!
  * @brief 闘技場用のアリーナ地形を作成する / Builds the on_defeat_arena_monster after it is entered -KMW-
@@ -340,19 +341,15 @@ static bool level_gen(PlayerType *player_ptr, concptr *why)
  */
 void wipe_generate_random_floor_flags(FloorType *floor_ptr)
 {
-    for (POSITION y = 0; y < floor_ptr->height; y++) {
-        for (POSITION x = 0; x < floor_ptr->width; x++) {
-            floor_ptr->grid_array[y][x].info &= ~(CAVE_MASK);
-        }
-    }
-
-    if (floor_ptr->dun_level > 0) {
-        for (POSITION y = 1; y < floor_ptr->height - 1; y++) {
-            for (POSITION x = 1; x < floor_ptr->width - 1; x++) {
-                floor_ptr->grid_array[y][x].info |= CAVE_UNSAFE;
-            }
+    const auto is_dungeon = floor_ptr->dun_level > 0;
+    const auto height = floor_ptr->height;
+    const auto width = floor_ptr->width;
+    for_each_grid(*floor_ptr, [is_dungeon, height, width](Grid &grid, const Pos2D &pos) {
+        grid.info &= ~(CAVE_MASK);
+        if (is_dungeon && (pos.y > 0) && (pos.y < height - 1) && (pos.x > 0) && (pos.x < width - 1)) {
+            grid.info |= CAVE_UNSAFE;
         }
-    }
+    });
 }
 
 /*!
@@ -365,6 +362,8 @@ void clear_cave(PlayerType *player_ptr)
     std::fill_n(floor_ptr->o_list.begin(), floor_ptr->o_max, ItemEntity{});
     floor_ptr->o_max = 1;
     floor_ptr->o_cnt = 0;
+    floor_ptr->o_free_list.clear();
+    floor_ptr->reset_item_feelings();
 
     for (auto &[r_idx, r_ref] : monraces_info) {
         r_ref.cur_num = 0;
@@ -373,6 +372,7 @@ void clear_cave(PlayerType *player_ptr)
     std::fill_n(floor_ptr->m_list.begin(), floor_ptr->m_max, MonsterEntity{});
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
+    floor_ptr->m_free_list.clear();
     for (int i = 0; i < MAX_MTIMED; i++) {
         floor_ptr->mproc_max[i] = 0;
     }
@@ -398,92 +398,35 @@ void clear_cave(PlayerType *player_ptr)
     floor_ptr->object_level = floor_ptr->base_level;
 }
 
-typedef bool (*IsWallFunc)(const FloorType *, int, int);
-
-// (y,x) がプレイヤーが通れない永久地形かどうかを返す。
-static bool is_permanent_blocker(const FloorType *const floor_ptr, const int y, const int x)
-{
-    const auto &flags = floor_ptr->get_grid({ y, x }).get_terrain().flags;
-    return flags.has(TerrainCharacteristics::PERMANENT) && flags.has_not(TerrainCharacteristics::MOVE);
-}
-
-static void floor_is_connected_dfs(const FloorType *const floor_ptr, const IsWallFunc is_wall, const int y_start, const int x_start, bool *const visited)
+/*!
+ * @brief 永久地形で孤立した区画を、間の永久地形1マスを通常の地形に変えることで繋ぐ
+ * @param floor フロアへの参照
+ * @return 最終的にフロアが連結になったらtrue
+ * @details 繋げられない場合や繋ぐ箇所が多すぎる場合は、フロア全体を生成し直すよう偽を返す.
+ * Vaultの一部である永久地形は書き換えない.
+ */
+static bool connect_isolated_areas(FloorType &floor)
 {
-    // clang-format off
-    static const int DY[8] = { -1, -1, -1,  0, 0,  1, 1, 1 };
-    static const int DX[8] = { -1,  0,  1, -1, 1, -1, 0, 1 };
-    // clang-format on
-
-    const int h = floor_ptr->height;
-    const int w = floor_ptr->width;
-    const int start = w * y_start + x_start;
-
-    // 深さ優先探索用のスタック。
-    // 最大フロアサイズが h=66, w=198 なので、スタックオーバーフロー防止のため再帰は使わない。
-    std::stack<int> stk;
-
-    stk.emplace(start);
-    visited[start] = true;
-
-    while (!stk.empty()) {
-        const int cur = stk.top();
-        stk.pop();
-        const int y = cur / w;
-        const int x = cur % w;
-
-        for (int i = 0; i < 8; ++i) {
-            const int y_nxt = y + DY[i];
-            const int x_nxt = x + DX[i];
-            if (y_nxt < 0 || h <= y_nxt || x_nxt < 0 || w <= x_nxt) {
-                continue;
-            }
-            const int nxt = w * y_nxt + x_nxt;
-            if (visited[nxt]) {
-                continue;
-            }
-            if (is_wall(floor_ptr, y_nxt, x_nxt)) {
-                continue;
-            }
-
-            stk.emplace(nxt);
-            visited[nxt] = true;
+    constexpr auto MAX_BRIDGES = 4;
+    FloorConnectivity connectivity(floor);
+    for (auto num_bridges = 0; !connectivity.is_connected(); num_bridges++) {
+        const auto pos = connectivity.find_bridge();
+        if (!pos || (num_bridges >= MAX_BRIDGES)) {
+            return false;
         }
-    }
-}
-
-// 現在のフロアが連結かどうかを返す。
-// 各セルの8近傍は互いに移動可能とし、is_wall が真を返すセルのみを壁とみなす。
-//
-// 連結成分数が 0 の場合、偽を返す。
-static bool floor_is_connected(const FloorType *const floor_ptr, const IsWallFunc is_wall)
-{
-    static std::array<bool, MAX_HGT * MAX_WID> visited;
-
-    const int h = floor_ptr->height;
-    const int w = floor_ptr->width;
 
-    std::fill(begin(visited), end(visited), false);
-
-    int n_component = 0; // 連結成分数
-
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            const int idx = w * y + x;
-            if (visited[idx]) {
-                continue;
-            }
-            if (is_wall(floor_ptr, y, x)) {
-                continue;
-            }
-
-            if (++n_component >= 2) {
-                break;
-            }
-            floor_is_connected_dfs(floor_ptr, is_wall, y, x, visited.data());
+        auto &grid = floor.get_grid(*pos);
+        const auto feat = feat_state(&floor, grid.feat, TerrainCharacteristics::UNPERM);
+        if (TerrainList::get_instance()[feat].flags.has(TerrainCharacteristics::PERMANENT)) {
+            return false;
         }
+
+        grid.feat = feat;
+        grid.mimic = 0;
+        connectivity.open(*pos);
     }
 
-    return n_component == 1;
+    return true;
 }
 
 /*!
@@ -525,11 +468,11 @@ void generate_floor(PlayerType *player_ptr)
         }
 
         // ダンジョン内フロアが連結でない(永久壁で区切られた孤立部屋がある)場合、
-        // 狂戦士でのプレイに支障をきたしうるので再生成する。
+        // 狂戦士でのプレイに支障をきたしうるので、間の永久壁を崩して繋ぐ。繋げなければ再生成する。
         // 地上、荒野マップ、クエストでは連結性判定は行わない。
         // TODO: 本来はダンジョン生成アルゴリズム自身で連結性を保証するのが理想ではある。
         const bool check_conn = okay && floor_ptr->dun_level > 0 && !floor_ptr->is_in_quest();
-        if (check_conn && !floor_is_connected(floor_ptr, is_permanent_blocker)) {
+        if (check_conn && !connect_isolated_areas(*floor_ptr)) {
             // 一定回数試しても連結にならないなら諦める。
             if (num >= 1000) {
                 plog("cannot generate connected floor. giving up...");
@@ -204,6 +204,7 @@ void delete_all_items_from_floor(PlayerType *player_ptr, POSITION y, POSITION x)
         o_ptr = &floor_ptr->o_list[this_o_idx];
         o_ptr->wipe();
         floor_ptr->o_cnt--;
+        floor_ptr->o_free_list.push_back(this_o_idx);
     }
 
     g_ptr->o_idx_list.clear();
@@ -285,6 +286,8 @@ void delete_object_idx(PlayerType *player_ptr, OBJECT_IDX o_idx)
 
     j_ptr->wipe();
     floor_ptr->o_cnt--;
+    floor_ptr->o_free_list.push_back(o_idx);
+    floor_ptr->invalidate_item_feeling(o_idx);
     static constexpr auto flags = {
         SubWindowRedrawingFlag::FLOOR_ITEMS,
         SubWindowRedrawingFlag::FOUND_ITEMS,
@@ -525,6 +528,7 @@ OBJECT_IDX drop_near(PlayerType *player_ptr, ItemEntity *j_ptr, PERCENTAGE chanc
         o_ptr = &floor_ptr->o_list[this_o_idx];
         if (object_similar(o_ptr, j_ptr)) {
             object_absorb(o_ptr, j_ptr);
+            floor_ptr->invalidate_item_feeling(this_o_idx);
             done = true;
             break;
         }
@@ -657,5 +661,10 @@ ItemEntity *choose_object(PlayerType *player_ptr, short *initial_i_idx, concptr
         return nullptr;
     }
 
+    // 選んだ床上のアイテムは呼び出し元で鑑定・変化し得るため、雰囲気への寄与を求め直させる
+    if (i_idx < 0) {
+        player_ptr->current_floor_ptr->invalidate_item_feeling(0 - i_idx);
+    }
+
     return ref_item(player_ptr, i_idx);
 }
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "system/floor-type-definition.h"
+#include "system/grid-type-definition.h"
+#include "util/point-2d.h"
+
+/*!
+ * @brief フロアの全マスに処理を適用する
+ * @param floor フロアへの参照
+ * @param func マスとその座標を受け取る処理
+ * @details 上の行から順に、各行を左から右へ処理する.
+ */
+template <typename Func>
+void for_each_grid(FloorType &floor, Func &&func)
+{
+    for (auto y = 0; y < floor.height; y++) {
+        auto &row = floor.grid_array[y];
+        for (auto x = 0; x < floor.width; x++) {
+            func(row[x], Pos2D(y, x));
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include "floor/cave.h"
 #include "floor/floor-object.h"
 #include "floor/floor-town.h"
+#include "floor/floor-traversal.h"
 #include "floor/geometry.h"
 #include "floor/line-of-sight.h"
 #include "game-option/birth-options.h"
@@ -64,12 +65,10 @@ void update_smell(FloorType *floor_ptr, PlayerType *player_ptr)
     };
 
     if (++scent_when == 254) {
-        for (auto y = 0; y < floor_ptr->height; y++) {
-            for (auto x = 0; x < floor_ptr->width; x++) {
-                int w = floor_ptr->grid_array[y][x].when;
-                floor_ptr->grid_array[y][x].when = (w > 128) ? (w - 128) : 0;
-            }
-        }
+        for_each_grid(*floor_ptr, [](Grid &grid, const Pos2D &) {
+            int w = grid.when;
+            grid.when = (w > 128) ? (w - 128) : 0;
+        });
 
         scent_when = 126;
     }
@@ -99,14 +98,11 @@ void update_smell(FloorType *floor_ptr, PlayerType *player_ptr)
  */
 void forget_flow(FloorType *floor_ptr)
 {
-    for (POSITION y = 0; y < floor_ptr->height; y++) {
-        for (POSITION x = 0; x < floor_ptr->width; x++) {
-            auto &grid = floor_ptr->grid_array[y][x];
-            grid.reset_costs();
-            grid.reset_dists();
-            floor_ptr->grid_array[y][x].when = 0;
-        }
-    }
+    for_each_grid(*floor_ptr, [](Grid &grid, const Pos2D &) {
+        grid.reset_costs();
+        grid.reset_dists();
+        grid.when = 0;
+    });
 }
 
 /*!
@@ -141,6 +137,8 @@ void wipe_o_list(FloorType *floor_ptr)
 
     floor_ptr->o_max = 1;
     floor_ptr->o_cnt = 0;
+    floor_ptr->o_free_list.clear();
+    floor_ptr->reset_item_feelings();
 }
 
 /*
@@ -184,6 +182,40 @@ void scatter(PlayerType *player_ptr, POSITION *yp, POSITION *xp, POSITION y, POS
     *xp = nx;
 }
 
+/*!
+ * @brief scatter() が選び得るマスを全て列挙する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param center 中心のマスの座標
+ * @param d 中心からの最大距離
+ * @param mode PROJECT_LOS を含めば視線、含まなければ射線が通るマスに限る
+ * @return 候補となるマスの一覧
+ * @details scatter() は正方形の範囲から一様に選んだマスを条件を満たすまで選び直すため、
+ * 同じ中心から何度も選ぶ場合はこの一覧から等確率に選べば同じ分布のまま試行を省ける.
+ */
+std::vector<Pos2D> enumerate_scatter_candidates(PlayerType *player_ptr, const Pos2D &center, POSITION d, BIT_FLAGS mode)
+{
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    std::vector<Pos2D> candidates;
+    for (auto ny = center.y - d; ny <= center.y + d; ny++) {
+        for (auto nx = center.x - d; nx <= center.x + d; nx++) {
+            if (!in_bounds(floor_ptr, ny, nx)) {
+                continue;
+            }
+
+            if ((d > 1) && (distance(center.y, center.x, ny, nx) > d)) {
+                continue;
+            }
+
+            const auto is_reachable = (mode & PROJECT_LOS) ? los(player_ptr, center.y, center.x, ny, nx) : projectable(player_ptr, center.y, center.x, ny, nx);
+            if (is_reachable) {
+                candidates.emplace_back(ny, nx);
+            }
+        }
+    }
+
+    return candidates;
+}
+
 /*!
  * @brief 現在のマップ名を返す /
  * @param player_ptr プレイヤーへの参照ポインタ
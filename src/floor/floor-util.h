@@ -1,7 +1,9 @@
 #pragma once
 
 #include "system/angband.h"
+#include "util/point-2d.h"
 #include <string>
+#include <vector>
 
 class FloorType;
 extern FloorType floor_info;
@@ -11,4 +13,5 @@ void update_smell(FloorType *floor_ptr, PlayerType *player_ptr);
 void forget_flow(FloorType *floor_ptr);
 void wipe_o_list(FloorType *floor_ptr);
 void scatter(PlayerType *player_ptr, POSITION *yp, POSITION *xp, POSITION y, POSITION x, POSITION d, BIT_FLAGS mode);
+std::vector<Pos2D> enumerate_scatter_candidates(PlayerType *player_ptr, const Pos2D &center, POSITION d, BIT_FLAGS mode);
 std::string map_name(PlayerType *player_ptr);
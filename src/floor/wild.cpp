@@ -15,6 +15,7 @@
 #include "dungeon/quest.h"
 #include "floor/cave.h"
 #include "floor/floor-town.h"
+#include "floor/floor-traversal.h"
 #include "game-option/birth-options.h"
 #include "game-option/map-screen-options.h"
 #include "grid/feature.h"
@@ -48,6 +49,10 @@
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
 #include "world/world.h"
+#include <algorithm>
+#include <array>
+#include <list>
+#include <optional>
 
 constexpr auto MAX_FEAT_IN_TERRAIN = 18;
 
@@ -75,6 +80,39 @@ struct wilderness_grid {
 
 static border_type border;
 
+/*!
+ * @brief 生成した荒野区画のうち、隣接区画の境界・角として参照される外周1マス内側の地形
+ */
+struct wilderness_edges {
+    std::array<int16_t, MAX_WID> north{}; /*!< Y=1 の行 */
+    std::array<int16_t, MAX_WID> south{}; /*!< Y=MAX_HGT-2 の行 */
+    std::array<int16_t, MAX_HGT> west{}; /*!< X=1 の列 */
+    std::array<int16_t, MAX_HGT> east{}; /*!< X=MAX_WID-2 の列 */
+};
+
+/*!
+ * @brief 荒野区画の地形を決める入力一式. 全てが一致すれば同じ地形が生成される
+ */
+struct wilderness_area_key {
+    POSITION y;
+    POSITION x;
+    uint32_t seed;
+    wt_type terrain;
+    int road;
+    std::array<bool, 4> neighbor_roads; /*!< 北・南・東・西の区画に道があるか (自身に道がなければ全てfalse) */
+    byte entrance;
+    bool is_total_winner;
+
+    bool operator==(const wilderness_area_key &) const = default;
+};
+
+/*!
+ * @brief 荒野区画の外周地形のLRUキャッシュ
+ * @details 荒野を1区画移動する毎に、中央と隣接8区画の計9区画分のプラズマフラクタルを生成し直すのを避ける.
+ */
+static std::list<std::pair<wilderness_area_key, wilderness_edges>> wilderness_edges_cache;
+constexpr auto WILDERNESS_EDGES_CACHE_SIZE = 16;
+
 static wilderness_grid w_letter[255];
 
 /* The default table in terrain level generation. */
@@ -388,6 +426,127 @@ static void generate_area(PlayerType *player_ptr, POSITION y, POSITION x, bool i
     w_ptr->rng = rng_backup;
 }
 
+/*!
+ * @brief 荒野区画の地形を決める入力一式を得る
+ * @param y 広域Y座標
+ * @param x 広域X座標
+ * @return キャッシュのキー. 町はクエストの進行等で地形が変わるためキャッシュせず、std::nulloptを返す
+ */
+static std::optional<wilderness_area_key> get_wilderness_area_key(POSITION y, POSITION x)
+{
+    const auto &area = wilderness[y][x];
+    if (area.town) {
+        return std::nullopt;
+    }
+
+    wilderness_area_key key{ y, x, area.seed, area.terrain, area.road, {}, area.entrance, w_ptr->total_winner != 0 };
+    if (area.road) {
+        key.neighbor_roads = { wilderness[y - 1][x].road != 0, wilderness[y + 1][x].road != 0, wilderness[y][x + 1].road != 0, wilderness[y][x - 1].road != 0 };
+    }
+
+    return key;
+}
+
+/*!
+ * @brief キャッシュから荒野区画の外周地形を探す
+ * @param key キャッシュのキー
+ * @return 見つかった外周地形へのポインタ. なければnullptr
+ */
+static const wilderness_edges *find_wilderness_edges(const std::optional<wilderness_area_key> &key)
+{
+    if (!key) {
+        return nullptr;
+    }
+
+    const auto it = std::find_if(wilderness_edges_cache.begin(), wilderness_edges_cache.end(), [&key](const auto &entry) { return entry.first == *key; });
+    if (it == wilderness_edges_cache.end()) {
+        return nullptr;
+    }
+
+    wilderness_edges_cache.splice(wilderness_edges_cache.begin(), wilderness_edges_cache, it);
+    return &wilderness_edges_cache.front().second;
+}
+
+/*!
+ * @brief フロアに生成した荒野区画の外周地形を取り出す
+ * @param floor 荒野区画を生成したフロアへの参照
+ * @return 外周地形
+ */
+static wilderness_edges extract_wilderness_edges(const FloorType &floor)
+{
+    wilderness_edges edges;
+    for (auto i = 1; i < MAX_WID - 1; i++) {
+        edges.north[i] = floor.grid_array[1][i].feat;
+        edges.south[i] = floor.grid_array[MAX_HGT - 2][i].feat;
+    }
+
+    for (auto i = 1; i < MAX_HGT - 1; i++) {
+        edges.west[i] = floor.grid_array[i][1].feat;
+        edges.east[i] = floor.grid_array[i][MAX_WID - 2].feat;
+    }
+
+    return edges;
+}
+
+/*!
+ * @brief フロアに生成した荒野区画の外周地形をキャッシュする
+ * @param key キャッシュのキー. std::nulloptならば何もしない
+ * @param floor 荒野区画を生成したフロアへの参照
+ */
+static void store_wilderness_edges(const std::optional<wilderness_area_key> &key, const FloorType &floor)
+{
+    if (!key || (find_wilderness_edges(key) != nullptr)) {
+        return;
+    }
+
+    wilderness_edges_cache.emplace_front(*key, extract_wilderness_edges(floor));
+    if (wilderness_edges_cache.size() > WILDERNESS_EDGES_CACHE_SIZE) {
+        wilderness_edges_cache.pop_back();
+    }
+}
+
+/*!
+ * @brief 隣接する荒野区画の外周地形を得る
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param y 広域Y座標
+ * @param x 広域X座標
+ * @return 外周地形. キャッシュになければフロアに辺部分として生成して求める
+ * @details 町以外の区画は辺部分としての生成と中央としての生成で地形が変わらないので、どちらの結果もキャッシュできる.
+ */
+static wilderness_edges get_neighbor_wilderness_edges(PlayerType *player_ptr, POSITION y, POSITION x)
+{
+    const auto key = get_wilderness_area_key(y, x);
+    if (const auto *edges = find_wilderness_edges(key); edges != nullptr) {
+        return *edges;
+    }
+
+    generate_area(player_ptr, y, x, true, false);
+    store_wilderness_edges(key, *player_ptr->current_floor_ptr);
+    return extract_wilderness_edges(*player_ptr->current_floor_ptr);
+}
+
+/*!
+ * @brief 角で隣接する荒野区画の、指定した1マスの地形を得る
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param y 広域Y座標
+ * @param x 広域X座標
+ * @param is_south 区画の下端 (Y=MAX_HGT-2) ならばtrue、上端 (Y=1) ならばfalse
+ * @param is_east 区画の右端 (X=MAX_WID-2) ならばtrue、左端 (X=1) ならばfalse
+ * @return 地形ID
+ * @details 角部分としての生成は四隅の乱数だけを引くので、キャッシュにない場合はそのまま生成する.
+ * 四隅の地形は辺部分・中央としての生成と同じ値になる.
+ */
+static int16_t get_corner_wilderness_feat(PlayerType *player_ptr, POSITION y, POSITION x, bool is_south, bool is_east)
+{
+    const auto fx = is_east ? MAX_WID - 2 : 1;
+    if (const auto *edges = find_wilderness_edges(get_wilderness_area_key(y, x)); edges != nullptr) {
+        return is_south ? edges->south[fx] : edges->north[fx];
+    }
+
+    generate_area(player_ptr, y, x, false, true);
+    return player_ptr->current_floor_ptr->grid_array[is_south ? MAX_HGT - 2 : 1][fx].feat;
+}
+
 /*!
  * @brief 地上マップにモンスターを生成する
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -429,47 +588,30 @@ void wilderness_gen(PlayerType *player_ptr)
     get_mon_num_prep(player_ptr, get_monster_hook(player_ptr), nullptr);
 
     /* North border */
-    generate_area(player_ptr, wild_y - 1, wild_x, true, false);
-    for (int i = 1; i < MAX_WID - 1; i++) {
-        border.north[i] = floor.grid_array[MAX_HGT - 2][i].feat;
-    }
+    const auto north_edges = get_neighbor_wilderness_edges(player_ptr, wild_y - 1, wild_x);
+    std::copy(north_edges.south.begin() + 1, north_edges.south.end() - 1, border.north + 1);
 
     /* South border */
-    generate_area(player_ptr, wild_y + 1, wild_x, true, false);
-    for (int i = 1; i < MAX_WID - 1; i++) {
-        border.south[i] = floor.grid_array[1][i].feat;
-    }
+    const auto south_edges = get_neighbor_wilderness_edges(player_ptr, wild_y + 1, wild_x);
+    std::copy(south_edges.north.begin() + 1, south_edges.north.end() - 1, border.south + 1);
 
     /* West border */
-    generate_area(player_ptr, wild_y, wild_x - 1, true, false);
-    for (int i = 1; i < MAX_HGT - 1; i++) {
-        border.west[i] = floor.grid_array[i][MAX_WID - 2].feat;
-    }
+    const auto west_edges = get_neighbor_wilderness_edges(player_ptr, wild_y, wild_x - 1);
+    std::copy(west_edges.east.begin() + 1, west_edges.east.end() - 1, border.west + 1);
 
     /* East border */
-    generate_area(player_ptr, wild_y, wild_x + 1, true, false);
-    for (int i = 1; i < MAX_HGT - 1; i++) {
-        border.east[i] = floor.grid_array[i][1].feat;
-    }
-
-    /* North west corner */
-    generate_area(player_ptr, wild_y - 1, wild_x - 1, false, true);
-    border.north_west = floor.grid_array[MAX_HGT - 2][MAX_WID - 2].feat;
-
-    /* North east corner */
-    generate_area(player_ptr, wild_y - 1, wild_x + 1, false, true);
-    border.north_east = floor.grid_array[MAX_HGT - 2][1].feat;
+    const auto east_edges = get_neighbor_wilderness_edges(player_ptr, wild_y, wild_x + 1);
+    std::copy(east_edges.west.begin() + 1, east_edges.west.end() - 1, border.east + 1);
 
-    /* South west corner */
-    generate_area(player_ptr, wild_y + 1, wild_x - 1, false, true);
-    border.south_west = floor.grid_array[1][MAX_WID - 2].feat;
-
-    /* South east corner */
-    generate_area(player_ptr, wild_y + 1, wild_x + 1, false, true);
-    border.south_east = floor.grid_array[1][1].feat;
+    /* Corners */
+    border.north_west = get_corner_wilderness_feat(player_ptr, wild_y - 1, wild_x - 1, true, true);
+    border.north_east = get_corner_wilderness_feat(player_ptr, wild_y - 1, wild_x + 1, true, false);
+    border.south_west = get_corner_wilderness_feat(player_ptr, wild_y + 1, wild_x - 1, false, true);
+    border.south_east = get_corner_wilderness_feat(player_ptr, wild_y + 1, wild_x + 1, false, false);
 
     /* Create terrain of the current area */
     generate_area(player_ptr, wild_y, wild_x, false, false);
+    store_wilderness_edges(get_wilderness_area_key(wild_y, wild_x), floor);
 
     /* Special boundary walls -- North */
     for (auto i = 0; i < MAX_WID; i++) {
@@ -503,40 +645,38 @@ void wilderness_gen(PlayerType *player_ptr)
     floor.get_grid({ 0, MAX_WID - 1 }).mimic = border.north_east;
     floor.get_grid({ MAX_HGT - 1, 0 }).mimic = border.south_west;
     floor.get_grid({ MAX_HGT - 1, MAX_WID - 1 }).mimic = border.south_east;
-    for (auto y = 0; y < floor.height; y++) {
-        for (auto x = 0; x < floor.width; x++) {
-            auto &grid = floor.get_grid({ y, x });
-            if (w_ptr->is_daytime()) {
-                grid.info |= CAVE_GLOW;
-                if (view_perma_grids) {
-                    grid.info |= CAVE_MARK;
-                }
-
-                continue;
+    const auto is_daytime = w_ptr->is_daytime();
+    for_each_grid(floor, [is_daytime](Grid &grid, const Pos2D &) {
+        if (is_daytime) {
+            grid.info |= CAVE_GLOW;
+            if (view_perma_grids) {
+                grid.info |= CAVE_MARK;
             }
 
-            const auto &terrain = grid.get_terrain_mimic();
-            auto can_darken = !grid.is_mirror();
-            can_darken &= terrain.flags.has_none_of({ TerrainCharacteristics::QUEST_ENTER, TerrainCharacteristics::ENTRANCE });
-            if (can_darken) {
-                grid.info &= ~(CAVE_GLOW);
-                if (terrain.flags.has_not(TerrainCharacteristics::REMEMBER)) {
-                    grid.info &= ~(CAVE_MARK);
-                }
+            return;
+        }
 
-                continue;
+        const auto &terrain = grid.get_terrain_mimic();
+        auto can_darken = !grid.is_mirror();
+        can_darken &= terrain.flags.has_none_of({ TerrainCharacteristics::QUEST_ENTER, TerrainCharacteristics::ENTRANCE });
+        if (can_darken) {
+            grid.info &= ~(CAVE_GLOW);
+            if (terrain.flags.has_not(TerrainCharacteristics::REMEMBER)) {
+                grid.info &= ~(CAVE_MARK);
             }
 
-            if (terrain.flags.has_not(TerrainCharacteristics::ENTRANCE)) {
-                continue;
-            }
+            return;
+        }
 
-            grid.info |= CAVE_GLOW;
-            if (view_perma_grids) {
-                grid.info |= CAVE_MARK;
-            }
+        if (terrain.flags.has_not(TerrainCharacteristics::ENTRANCE)) {
+            return;
         }
-    }
+
+        grid.info |= CAVE_GLOW;
+        if (view_perma_grids) {
+            grid.info |= CAVE_MARK;
+        }
+    });
 
     if (player_ptr->teleport_town) {
         for (auto y = 0; y < floor.height; y++) {
@@ -9,3 +9,4 @@ bool arg_monochrome; /* Command arg -- Request monochrome mode */
 bool arg_force_original; /* Command arg -- Request original keyset */
 bool arg_force_roguelike; /* Command arg -- Request roguelike keyset */
 bool arg_bigtile = false; /* Command arg -- Request big tile mode */
+int arg_monster_lod_radius = 0; /* Command arg -- Simplify monsters farther than this and out of LOS (0: off) */
@@ -54,6 +54,7 @@
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "system/terrain-type-definition.h"
+#include "system/turn-profiler.h"
 #include "term/gameterm.h"
 #include "term/term-color-types.h"
 #include "timed-effect/player-blindness.h"
@@ -664,6 +665,7 @@ static POSITION flow_y = 0;
  */
 void update_flow(PlayerType *player_ptr)
 {
+    TurnProfileScope profile_scope(TurnPhase::UPDATE_FLOW);
     auto &floor = *player_ptr->current_floor_ptr;
 
     /* The last way-point is on the map */
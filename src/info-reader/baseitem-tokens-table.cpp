@@ -5,7 +5,7 @@
  * オブジェクト基本特性トークンの定義 /
  * Object flags
  */
-const std::unordered_map<std::string_view, tr_type> baseitem_flags = {
+constexpr auto BASEITEM_FLAGS = make_perfect_hash_table<tr_type>({
     { "STR", TR_STR },
     { "INT", TR_INT },
     { "WIS", TR_WIS },
@@ -175,13 +175,15 @@ const std::unordered_map<std::string_view, tr_type> baseitem_flags = {
     { "SELF_ELEC", TR_SELF_ELEC },
     { "PERSISTENT_CURSE", TR_PERSISTENT_CURSE },
     { "VUL_CURSE", TR_VUL_CURSE },
-};
+});
+
+const PerfectHashTable<tr_type> baseitem_flags(BASEITEM_FLAGS);
 
 /*!
  * オブジェクト生成特性トークンの定義 /
  * Object flags
  */
-const std::unordered_map<std::string_view, ItemGenerationTraitType> baseitem_geneneration_flags = {
+constexpr auto BASEITEM_GENENERATION_FLAGS = make_perfect_hash_table<ItemGenerationTraitType>({
     { "INSTA_ART", ItemGenerationTraitType::INSTA_ART },
     { "QUESTITEM", ItemGenerationTraitType::QUESTITEM },
     { "XTRA_POWER", ItemGenerationTraitType::XTRA_POWER },
@@ -211,5 +213,7 @@ const std::unordered_map<std::string_view, ItemGenerationTraitType> baseitem_gen
     { "XTRA_DICE_SIDE", ItemGenerationTraitType::XTRA_DICE_SIDE },
     { "ADD_DICE", ItemGenerationTraitType::ADD_DICE },
     { "DOUBLED_DICE", ItemGenerationTraitType::DOUBLED_DICE },
-};
+});
+
+const PerfectHashTable<ItemGenerationTraitType> baseitem_geneneration_flags(BASEITEM_GENENERATION_FLAGS);
 // clang-format on
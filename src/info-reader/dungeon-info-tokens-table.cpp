@@ -5,7 +5,7 @@
  * ダンジョン特性トークンの定義 /
  * Dungeon flags
  */
-const std::unordered_map<std::string_view, DungeonFeatureType> dungeon_flags = {
+constexpr auto DUNGEON_FLAGS = make_perfect_hash_table<DungeonFeatureType>({
     { "WINNER", DungeonFeatureType::WINNER },
     { "MAZE", DungeonFeatureType::MAZE },
     { "SMALLEST", DungeonFeatureType::SMALLEST },
@@ -38,4 +38,6 @@ const std::unordered_map<std::string_view, DungeonFeatureType> dungeon_flags = {
     { "DARKNESS", DungeonFeatureType::DARKNESS },
     { "ACID_RIVER", DungeonFeatureType::ACID_RIVER },
     { "POISONOUS_RIVER", DungeonFeatureType::POISONOUS_RIVER },
-};
+});
+
+const PerfectHashTable<DungeonFeatureType> dungeon_flags(DUNGEON_FLAGS);
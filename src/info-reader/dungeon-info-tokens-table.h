@@ -1,10 +1,10 @@
 #pragma once
 
 #include "system/angband.h"
+#include "util/perfect-hash-table.h"
 
 #include <string_view>
-#include <unordered_map>
 
 enum class DungeonFeatureType;
 
-extern const std::unordered_map<std::string_view, DungeonFeatureType> dungeon_flags;
+extern const PerfectHashTable<DungeonFeatureType> dungeon_flags;
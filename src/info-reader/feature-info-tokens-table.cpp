@@ -3,7 +3,7 @@
 /*!
  * @brief 地形属性トークンの定義 / Feature info flags
  */
-const std::unordered_map<std::string_view, TerrainCharacteristics> f_info_flags = {
+constexpr auto F_INFO_FLAGS = make_perfect_hash_table<TerrainCharacteristics>({
     { "LOS", TerrainCharacteristics::LOS },
     { "PROJECT", TerrainCharacteristics::PROJECT },
     { "MOVE", TerrainCharacteristics::MOVE },
@@ -120,4 +120,6 @@ const std::unordered_map<std::string_view, TerrainCharacteristics> f_info_flags
     { "TELEPORTABLE", TerrainCharacteristics::TELEPORTABLE },
     { "CONVERT", TerrainCharacteristics::CONVERT },
     { "GLASS", TerrainCharacteristics::GLASS },
-};
+});
+
+const PerfectHashTable<TerrainCharacteristics> f_info_flags(F_INFO_FLAGS);
@@ -2,7 +2,7 @@
 
 #include "grid/feature-flag-types.h"
 #include "system/angband.h"
+#include "util/perfect-hash-table.h"
 #include <string_view>
-#include <unordered_map>
 
-extern const std::unordered_map<std::string_view, TerrainCharacteristics> f_info_flags;
+extern const PerfectHashTable<TerrainCharacteristics> f_info_flags;
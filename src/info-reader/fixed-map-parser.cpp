@@ -22,6 +22,7 @@
 #include "system/player-type-definition.h"
 #include "util/angband-files.h"
 #include "util/string-processor.h"
+#include "util/text-file-reader.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 #include <algorithm>
@@ -345,19 +346,18 @@ static void parse_quest_info_aux(std::string_view file_name, std::set<QuestId> &
     };
 
     const auto &path = path_build(ANGBAND_DIR_EDIT, file_name);
-    auto *fp = angband_fopen(path, FileOpenMode::READ);
-    if (fp == nullptr) {
+    TextFileReader reader(path);
+    if (!reader.is_open()) {
         std::stringstream ss;
         ss << _("ファイルが見つかりません (", "File is not found (") << file_name << ')';
         THROW_EXCEPTION(std::runtime_error, ss.str());
     }
 
-    char buf[4096];
     auto line_num = 0;
-    while (angband_fgets(fp, buf, sizeof(buf)) == 0) {
+    while (const auto line = reader.read_line()) {
         line_num++;
 
-        const auto token = str_split(buf, ':', true);
+        const auto token = str_split(*line, ':', true);
 
         switch (token[0][0]) {
         case 'Q': {
@@ -373,8 +373,6 @@ static void parse_quest_info_aux(std::string_view file_name, std::set<QuestId> &
             break;
         }
     }
-
-    angband_fclose(fp);
 }
 
 /*!
@@ -18,6 +18,7 @@
 #include "system/system-variables.h"
 #include "util/angband-files.h"
 #include "util/string-processor.h"
+#include "util/text-file-reader.h"
 #include <string>
 
 dungeon_grid letter[255];
@@ -25,28 +26,28 @@ dungeon_grid letter[255];
 /*!
  * @brief パース関数に基づいてデータファイルからデータを読み取る /
  * Initialize an "*_info" array, by parsing an ascii "template" file
- * @param fp 読み取りに使うファイルポインタ
- * @param buf 読み取りに使うバッファ領域
+ * @param reader 読み取りに使うファイル
  * @param head ヘッダ構造体
  * @param parse_info_txt_line パース関数
- * @return エラーコード, エラー行番号
+ * @return エラーコード, エラー行番号, 最後に読み取った行
  */
-std::tuple<errr, int> init_info_txt(FILE *fp, char *buf, angband_header *head, Parser parse_info_txt_line)
+std::tuple<errr, int, std::string_view> init_info_txt(TextFileReader &reader, angband_header *head, Parser parse_info_txt_line)
 {
     error_idx = -1;
     auto error_line = 0;
 
     util::SHA256 sha256;
 
-    while (angband_fgets(fp, buf, 1024) == 0) {
+    std::string_view line;
+    while (const auto next_line = reader.read_line()) {
         error_line++;
-        const std::string_view line = buf;
+        line = *next_line;
         if (line.empty() || line.starts_with('#')) {
             continue;
         }
 
         if (!line.substr(1).starts_with(':')) {
-            return { PARSE_ERROR_GENERIC, error_line };
+            return { PARSE_ERROR_GENERIC, error_line, line };
         }
 
         if (line.starts_with('V')) {
@@ -60,13 +61,13 @@ std::tuple<errr, int> init_info_txt(FILE *fp, char *buf, angband_header *head, P
         }
 
         if (auto err = parse_info_txt_line(line, head); err != 0) {
-            return { err, error_line };
+            return { err, error_line, line };
         }
     }
 
     head->digest = sha256.digest();
 
-    return { PARSE_ERROR_NONE, error_line };
+    return { PARSE_ERROR_NONE, error_line, line };
 }
 
 /*!
@@ -25,8 +25,9 @@ extern dungeon_grid letter[255];
 
 struct angband_header;
 class FloorType;
+class TextFileReader;
 
 using Parser = std::function<errr(std::string_view, angband_header *)>;
-std::tuple<errr, int> init_info_txt(FILE *fp, char *buf, angband_header *head, Parser parse_info_txt_line);
+std::tuple<errr, int, std::string_view> init_info_txt(TextFileReader &reader, angband_header *head, Parser parse_info_txt_line);
 parse_error_type parse_line_feature(FloorType *floor_ptr, char *buf);
 parse_error_type parse_line_building(char *buf);
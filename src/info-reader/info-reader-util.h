@@ -24,7 +24,7 @@ void append_english_text(std::string &text, std::string_view add);
 // clang-format off
 /*!
  * @brief 型Keyをキーとして持つような連想配列型のコンセプト
- * std::mapやstd::unordered_mapなどが該当する
+ * std::mapやstd::unordered_map、PerfectHashTableなどが該当する
  */
 template <typename T, typename Key>
 concept DictIndexedBy = requires(T t, Key k) {
@@ -4,31 +4,36 @@
 #include "main/angband-headers.h"
 #include "player-ability/player-ability-types.h"
 #include "player-info/class-info.h"
+#include "util/perfect-hash-table.h"
 #include "util/string-processor.h"
 
 namespace {
 /*!
  * @brief 魔法タイプ名とtvalの対応表
  */
-const std::unordered_map<std::string_view, ItemKindType> name_to_tval = {
+constexpr auto NAME_TO_TVAL = make_perfect_hash_table<ItemKindType>({
     { "SORCERY", ItemKindType::SORCERY_BOOK },
     { "LIFE", ItemKindType::LIFE_BOOK },
     { "MUSIC", ItemKindType::MUSIC_BOOK },
     { "HISSATSU", ItemKindType::HISSATSU_BOOK },
     { "NONE", ItemKindType::NONE },
-};
+});
+
+constexpr PerfectHashTable<ItemKindType> name_to_tval(NAME_TO_TVAL);
 
 /*!
  * @brief 魔法必須能力とenumの対応表
  */
-const std::unordered_map<std::string_view, int> name_to_stat = {
+constexpr auto NAME_TO_STAT = make_perfect_hash_table<int>({
     { "STR", A_STR },
     { "INT", A_INT },
     { "WIS", A_WIS },
     { "DEX", A_DEX },
     { "CON", A_CON },
     { "CHR", A_CHR },
-};
+});
+
+constexpr PerfectHashTable<int> name_to_stat(NAME_TO_STAT);
 }
 
 /*!
@@ -15,7 +15,7 @@
  * モンスターの打撃手段トークンの定義 /
  * Monster Blow Methods
  */
-const std::unordered_map<std::string_view, RaceBlowMethodType> r_info_blow_method = {
+constexpr auto R_INFO_BLOW_METHOD = make_perfect_hash_table<RaceBlowMethodType>({
     { "HIT", RaceBlowMethodType::HIT },
     { "TOUCH", RaceBlowMethodType::TOUCH },
     { "PUNCH", RaceBlowMethodType::PUNCH },
@@ -41,13 +41,15 @@ const std::unordered_map<std::string_view, RaceBlowMethodType> r_info_blow_metho
     { "MOAN", RaceBlowMethodType::MOAN },
     { "SHOW", RaceBlowMethodType::SHOW },
     { "SHOOT", RaceBlowMethodType::SHOOT },
-};
+});
+
+const PerfectHashTable<RaceBlowMethodType> r_info_blow_method(R_INFO_BLOW_METHOD);
 
 /*!
  * モンスターの打撃属性トークンの定義 /
  * Monster Blow Effects
  */
-const std::unordered_map<std::string_view, RaceBlowEffectType> r_info_blow_effect = {
+constexpr auto R_INFO_BLOW_EFFECT = make_perfect_hash_table<RaceBlowEffectType>({
     { "HURT", RaceBlowEffectType::HURT },
     { "POISON", RaceBlowEffectType::POISON },
     { "UN_BONUS", RaceBlowEffectType::UN_BONUS },
@@ -85,13 +87,15 @@ const std::unordered_map<std::string_view, RaceBlowEffectType> r_info_blow_effec
     { "STUN", RaceBlowEffectType::STUN },
     { "HUNGRY", RaceBlowEffectType::HUNGRY },
     { "FLAVOR", RaceBlowEffectType::FLAVOR },
-};
+});
+
+const PerfectHashTable<RaceBlowEffectType> r_info_blow_effect(R_INFO_BLOW_EFFECT);
 
 /*!
  * モンスター特性トークンの定義1 /
  * Monster race flags
  */
-const std::unordered_map<std::string_view, race_flags1> r_info_flags1 = {
+constexpr auto R_INFO_FLAGS1 = make_perfect_hash_table<race_flags1>({
     { "QUESTOR", RF1_QUESTOR },
     { "MALE", RF1_MALE },
     { "FEMALE", RF1_FEMALE },
@@ -101,13 +105,15 @@ const std::unordered_map<std::string_view, race_flags1> r_info_flags1 = {
     { "FRIENDS", RF1_FRIENDS },
     { "ESCORT", RF1_ESCORT },
     { "ESCORTS", RF1_ESCORTS },
-};
+});
+
+const PerfectHashTable<race_flags1> r_info_flags1(R_INFO_FLAGS1);
 
 /*!
  * モンスター特性トークンの定義2 /
  * Monster race flags
  */
-const std::unordered_map<std::string_view, race_flags2> r_info_flags2 = {
+constexpr auto R_INFO_FLAGS2 = make_perfect_hash_table<race_flags2>({
     { "REFLECTING", RF2_REFLECTING },
     { "INVISIBLE", RF2_INVISIBLE },
     { "COLD_BLOOD", RF2_COLD_BLOOD },
@@ -120,14 +126,16 @@ const std::unordered_map<std::string_view, race_flags2> r_info_flags2 = {
     { "ELDRITCH_HORROR", RF2_ELDRITCH_HORROR },
     { "FLAGS2_XX14", RF2_XX14 },
     { "FLAGS2_XX15", RF2_XX15 },
-};
+});
+
+const PerfectHashTable<race_flags2> r_info_flags2(R_INFO_FLAGS2);
 
 /*!
  * モンスター特性トークン (発動型能力) /
  * Monster race flags
  */
 /* clang-format off */
-const std::unordered_map<std::string_view, MonsterAbilityType> r_info_ability_flags = {
+constexpr auto R_INFO_ABILITY_FLAGS = make_perfect_hash_table<MonsterAbilityType>({
 	{"SHRIEK", MonsterAbilityType::SHRIEK },
 	{"XXX1", MonsterAbilityType::XXX1 },
 	{"DISPEL", MonsterAbilityType::DISPEL },
@@ -235,7 +243,9 @@ const std::unordered_map<std::string_view, MonsterAbilityType> r_info_ability_fl
 	{"S_AMBERITES", MonsterAbilityType::S_AMBERITES },
 	{"S_UNIQUE", MonsterAbilityType::S_UNIQUE },
 	{"S_DEAD_UNIQUE", MonsterAbilityType::S_DEAD_UNIQUE },
-};
+});
+
+const PerfectHashTable<MonsterAbilityType> r_info_ability_flags(R_INFO_ABILITY_FLAGS);
 /* clang-format on */
 
 /*!
@@ -243,27 +253,31 @@ const std::unordered_map<std::string_view, MonsterAbilityType> r_info_ability_fl
  * @details ダンジョンの主は、DungeonDefinitions の FINAL_GUARDIAN_HOGE にて自動指定
  * HOGE は、MonsterRaceDefinitions で定義したモンスター種族ID
  */
-const std::unordered_map<std::string_view, race_flags7> r_info_flags7 = {
+constexpr auto R_INFO_FLAGS7 = make_perfect_hash_table<race_flags7>({
     { "UNIQUE2", RF7_UNIQUE2 },
     { "RIDING", RF7_RIDING },
     { "KAGE", RF7_KAGE },
     { "CHAMELEON", RF7_CHAMELEON },
     { "TANUKI", RF7_TANUKI },
-};
+});
+
+const PerfectHashTable<race_flags7> r_info_flags7(R_INFO_FLAGS7);
 
 /*!
  * モンスター特性トークンの定義8 /
  * Monster race flags
  */
-const std::unordered_map<std::string_view, race_flags8> r_info_flags8 = {
+constexpr auto R_INFO_FLAGS8 = make_perfect_hash_table<race_flags8>({
     { "NO_QUEST", RF8_NO_QUEST },
-};
+});
+
+const PerfectHashTable<race_flags8> r_info_flags8(R_INFO_FLAGS8);
 
 /*!
  * モンスター特性トークンの定義R(耐性) /
  * Monster race flags
  */
-const std::unordered_map<std::string_view, MonsterResistanceType> r_info_flagsr = {
+constexpr auto R_INFO_FLAGSR = make_perfect_hash_table<MonsterResistanceType>({
     { "RES_ALL", MonsterResistanceType::RESIST_ALL },
     { "HURT_ACID", MonsterResistanceType::HURT_ACID },
     { "RES_ACID", MonsterResistanceType::RESIST_ACID },
@@ -321,9 +335,11 @@ const std::unordered_map<std::string_view, MonsterResistanceType> r_info_flagsr
     { "NO_STUN", MonsterResistanceType::NO_STUN },
     { "NO_CONF", MonsterResistanceType::NO_CONF },
     { "NO_SLEEP", MonsterResistanceType::NO_SLEEP }
-};
+});
 
-const std::unordered_map<std::string_view, MonsterAuraType> r_info_aura_flags = {
+const PerfectHashTable<MonsterResistanceType> r_info_flagsr(R_INFO_FLAGSR);
+
+constexpr auto R_INFO_AURA_FLAGS = make_perfect_hash_table<MonsterAuraType>({
     { "AURA_FIRE", MonsterAuraType::FIRE },
     { "AURA_COLD", MonsterAuraType::COLD },
     { "AURA_ELEC", MonsterAuraType::ELEC },
@@ -348,9 +364,11 @@ const std::unordered_map<std::string_view, MonsterAuraType> r_info_aura_flags =
     { "AURA_GRAVITY", MonsterAuraType::GRAVITY },
     { "AURA_VOIDS", MonsterAuraType::VOIDS },
     { "AURA_ABYSS", MonsterAuraType::ABYSS },
-};
+});
+
+const PerfectHashTable<MonsterAuraType> r_info_aura_flags(R_INFO_AURA_FLAGS);
 
-const std::unordered_map<std::string_view, MonsterBehaviorType> r_info_behavior_flags = {
+constexpr auto R_INFO_BEHAVIOR_FLAGS = make_perfect_hash_table<MonsterBehaviorType>({
     { "NEVER_BLOW", MonsterBehaviorType::NEVER_BLOW },
     { "NEVER_MOVE", MonsterBehaviorType::NEVER_MOVE },
     { "OPEN_DOOR", MonsterBehaviorType::OPEN_DOOR },
@@ -365,18 +383,22 @@ const std::unordered_map<std::string_view, MonsterBehaviorType> r_info_behavior_
     { "SMART", MonsterBehaviorType::SMART },
     { "FRIENDLY", MonsterBehaviorType::FRIENDLY },
     { "PREVENT_SUDDEN_MAGIC", MonsterBehaviorType::PREVENT_SUDDEN_MAGIC },
-};
+});
 
-const std::unordered_map<std::string_view, MonsterVisualType> r_info_visual_flags = {
+const PerfectHashTable<MonsterBehaviorType> r_info_behavior_flags(R_INFO_BEHAVIOR_FLAGS);
+
+constexpr auto R_INFO_VISUAL_FLAGS = make_perfect_hash_table<MonsterVisualType>({
     { "CHAR_CLEAR", MonsterVisualType::CLEAR },
     { "SHAPECHANGER", MonsterVisualType::SHAPECHANGER },
     { "ATTR_CLEAR", MonsterVisualType::CLEAR_COLOR },
     { "ATTR_MULTI", MonsterVisualType::MULTI_COLOR },
     { "ATTR_SEMIRAND", MonsterVisualType::RANDOM_COLOR },
     { "ATTR_ANY", MonsterVisualType::ANY_COLOR },
-};
+});
+
+const PerfectHashTable<MonsterVisualType> r_info_visual_flags(R_INFO_VISUAL_FLAGS);
 
-const std::unordered_map<std::string_view, MonsterKindType> r_info_kind_flags = {
+constexpr auto R_INFO_KIND_FLAGS = make_perfect_hash_table<MonsterKindType>({
     { "UNIQUE", MonsterKindType::UNIQUE },
     { "HUMAN", MonsterKindType::HUMAN },
     { "QUANTUM", MonsterKindType::QUANTUM },
@@ -392,9 +414,11 @@ const std::unordered_map<std::string_view, MonsterKindType> r_info_kind_flags =
     { "GOOD", MonsterKindType::GOOD },
     { "NONLIVING", MonsterKindType::NONLIVING },
     { "ANGEL", MonsterKindType::ANGEL },
-};
+});
+
+const PerfectHashTable<MonsterKindType> r_info_kind_flags(R_INFO_KIND_FLAGS);
 
-const std::unordered_map<std::string_view, MonsterDropType> r_info_drop_flags = {
+constexpr auto R_INFO_DROP_FLAGS = make_perfect_hash_table<MonsterDropType>({
     { "ONLY_GOLD", MonsterDropType::ONLY_GOLD },
     { "ONLY_ITEM", MonsterDropType::ONLY_ITEM },
     { "DROP_GOOD", MonsterDropType::DROP_GOOD },
@@ -407,9 +431,11 @@ const std::unordered_map<std::string_view, MonsterDropType> r_info_drop_flags =
     { "DROP_2D2", MonsterDropType::DROP_2D2 },
     { "DROP_3D2", MonsterDropType::DROP_3D2 },
     { "DROP_4D2", MonsterDropType::DROP_4D2 },
-};
+});
 
-const std::unordered_map<std::string_view, MonsterWildernessType> r_info_wilderness_flags = {
+const PerfectHashTable<MonsterDropType> r_info_drop_flags(R_INFO_DROP_FLAGS);
+
+constexpr auto R_INFO_WILDERNESS_FLAGS = make_perfect_hash_table<MonsterWildernessType>({
     { "WILD_ONLY", MonsterWildernessType::WILD_ONLY },
     { "WILD_TOWN", MonsterWildernessType::WILD_TOWN },
     { "WILD_SHORE", MonsterWildernessType::WILD_SHORE },
@@ -421,30 +447,38 @@ const std::unordered_map<std::string_view, MonsterWildernessType> r_info_wildern
     { "WILD_GRASS", MonsterWildernessType::WILD_GRASS },
     { "WILD_SWAMP", MonsterWildernessType::WILD_SWAMP },
     { "WILD_ALL", MonsterWildernessType::WILD_ALL },
-};
+});
+
+const PerfectHashTable<MonsterWildernessType> r_info_wilderness_flags(R_INFO_WILDERNESS_FLAGS);
 
-const std::unordered_map<std::string_view, MonsterFeatureType> r_info_feature_flags = {
+constexpr auto R_INFO_FEATURE_FLAGS = make_perfect_hash_table<MonsterFeatureType>({
     { "PASS_WALL", MonsterFeatureType::PASS_WALL },
     { "KILL_WALL", MonsterFeatureType::KILL_WALL },
     { "AQUATIC", MonsterFeatureType::AQUATIC },
     { "CAN_SWIM", MonsterFeatureType::CAN_SWIM },
     { "CAN_FLY", MonsterFeatureType::CAN_FLY },
-};
+});
 
-const std::unordered_map<std::string_view, MonsterPopulationType> r_info_population_flags = {
+const PerfectHashTable<MonsterFeatureType> r_info_feature_flags(R_INFO_FEATURE_FLAGS);
+
+constexpr auto R_INFO_POPULATION_FLAGS = make_perfect_hash_table<MonsterPopulationType>({
     { "NAZGUL", MonsterPopulationType::NAZGUL },
-};
+});
+
+const PerfectHashTable<MonsterPopulationType> r_info_population_flags(R_INFO_POPULATION_FLAGS);
 
-const std::unordered_map<std::string_view, MonsterSpeakType> r_info_speak_flags = {
+constexpr auto R_INFO_SPEAK_FLAGS = make_perfect_hash_table<MonsterSpeakType>({
     { "SPEAK_ALL", MonsterSpeakType::SPEAK_ALL },
     { "SPEAK_BATTLE", MonsterSpeakType::SPEAK_BATTLE },
     { "SPEAK_FEAR", MonsterSpeakType::SPEAK_FEAR },
     { "SPEAK_FRIEND", MonsterSpeakType::SPEAK_FRIEND },
     { "SPEAK_DEATH", MonsterSpeakType::SPEAK_DEATH },
     { "SPEAK_SPAWN", MonsterSpeakType::SPEAK_SPAWN },
-};
+});
 
-const std::unordered_map<std::string_view, MonsterBrightnessType> r_info_brightness_flags = {
+const PerfectHashTable<MonsterSpeakType> r_info_speak_flags(R_INFO_SPEAK_FLAGS);
+
+constexpr auto R_INFO_BRIGHTNESS_FLAGS = make_perfect_hash_table<MonsterBrightnessType>({
     { "HAS_LITE_1", MonsterBrightnessType::HAS_LITE_1 },
     { "SELF_LITE_1", MonsterBrightnessType::SELF_LITE_1 },
     { "HAS_LITE_2", MonsterBrightnessType::HAS_LITE_2 },
@@ -453,4 +487,6 @@ const std::unordered_map<std::string_view, MonsterBrightnessType> r_info_brightn
     { "SELF_DARK_1", MonsterBrightnessType::SELF_DARK_1 },
     { "HAS_DARK_2", MonsterBrightnessType::HAS_DARK_2 },
     { "SELF_DARK_2", MonsterBrightnessType::SELF_DARK_2 },
-};
+});
+
+const PerfectHashTable<MonsterBrightnessType> r_info_brightness_flags(R_INFO_BRIGHTNESS_FLAGS);
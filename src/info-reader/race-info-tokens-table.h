@@ -20,27 +20,27 @@
 #include "monster-race/race-visual-flags.h"
 #include "monster-race/race-wilderness-flags.h"
 #include "system/angband.h"
+#include "util/perfect-hash-table.h"
 
 #include <string_view>
-#include <unordered_map>
 
 enum class MonsterAbilityType;
 
-extern const std::unordered_map<std::string_view, RaceBlowMethodType> r_info_blow_method;
-extern const std::unordered_map<std::string_view, RaceBlowEffectType> r_info_blow_effect;
-extern const std::unordered_map<std::string_view, race_flags1> r_info_flags1;
-extern const std::unordered_map<std::string_view, race_flags2> r_info_flags2;
-extern const std::unordered_map<std::string_view, MonsterAbilityType> r_info_ability_flags;
-extern const std::unordered_map<std::string_view, race_flags7> r_info_flags7;
-extern const std::unordered_map<std::string_view, race_flags8> r_info_flags8;
-extern const std::unordered_map<std::string_view, MonsterResistanceType> r_info_flagsr;
-extern const std::unordered_map<std::string_view, MonsterAuraType> r_info_aura_flags;
-extern const std::unordered_map<std::string_view, MonsterBehaviorType> r_info_behavior_flags;
-extern const std::unordered_map<std::string_view, MonsterVisualType> r_info_visual_flags;
-extern const std::unordered_map<std::string_view, MonsterKindType> r_info_kind_flags;
-extern const std::unordered_map<std::string_view, MonsterDropType> r_info_drop_flags;
-extern const std::unordered_map<std::string_view, MonsterWildernessType> r_info_wilderness_flags;
-extern const std::unordered_map<std::string_view, MonsterFeatureType> r_info_feature_flags;
-extern const std::unordered_map<std::string_view, MonsterPopulationType> r_info_population_flags;
-extern const std::unordered_map<std::string_view, MonsterSpeakType> r_info_speak_flags;
-extern const std::unordered_map<std::string_view, MonsterBrightnessType> r_info_brightness_flags;
+extern const PerfectHashTable<RaceBlowMethodType> r_info_blow_method;
+extern const PerfectHashTable<RaceBlowEffectType> r_info_blow_effect;
+extern const PerfectHashTable<race_flags1> r_info_flags1;
+extern const PerfectHashTable<race_flags2> r_info_flags2;
+extern const PerfectHashTable<MonsterAbilityType> r_info_ability_flags;
+extern const PerfectHashTable<race_flags7> r_info_flags7;
+extern const PerfectHashTable<race_flags8> r_info_flags8;
+extern const PerfectHashTable<MonsterResistanceType> r_info_flagsr;
+extern const PerfectHashTable<MonsterAuraType> r_info_aura_flags;
+extern const PerfectHashTable<MonsterBehaviorType> r_info_behavior_flags;
+extern const PerfectHashTable<MonsterVisualType> r_info_visual_flags;
+extern const PerfectHashTable<MonsterKindType> r_info_kind_flags;
+extern const PerfectHashTable<MonsterDropType> r_info_drop_flags;
+extern const PerfectHashTable<MonsterWildernessType> r_info_wilderness_flags;
+extern const PerfectHashTable<MonsterFeatureType> r_info_feature_flags;
+extern const PerfectHashTable<MonsterPopulationType> r_info_population_flags;
+extern const PerfectHashTable<MonsterSpeakType> r_info_speak_flags;
+extern const PerfectHashTable<MonsterBrightnessType> r_info_brightness_flags;
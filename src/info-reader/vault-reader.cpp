@@ -62,3 +62,14 @@ errr parse_vaults_info(std::string_view buf, angband_header *)
 
     return PARSE_ERROR_NONE;
 }
+
+/*!
+ * @brief 読み込んだVaultの文字列を配置用のマスの一覧に変換する
+ * @param head ヘッダ構造体
+ */
+void retouch_vaults_info(angband_header *)
+{
+    for (auto &vault : vaults_info) {
+        vault.compile_tiles();
+    }
+}
@@ -90,10 +90,9 @@ void py_pickup_floor(PlayerType *player_ptr, bool pickup)
     int floor_num = 0;
     OBJECT_IDX floor_o_idx = 0;
     int can_pickup = 0;
-    auto &o_idx_list = player_ptr->current_floor_ptr->grid_array[player_ptr->y][player_ptr->x].o_idx_list;
+    const auto o_idx_list = player_ptr->current_floor_ptr->grid_array[player_ptr->y][player_ptr->x].o_idx_list;
     auto &rfu = RedrawingFlagsUpdater::get_instance();
-    for (auto it = o_idx_list.begin(); it != o_idx_list.end();) {
-        const OBJECT_IDX this_o_idx = *it++;
+    for (const auto this_o_idx : o_idx_list) {
         auto *o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
         const auto item_name = describe_flavor(player_ptr, o_ptr, 0);
         disturb(player_ptr, false, false);
@@ -255,8 +254,8 @@ void carry(PlayerType *player_ptr, bool pickup)
         return;
     }
 
-    for (auto it = g_ptr->o_idx_list.begin(); it != g_ptr->o_idx_list.end();) {
-        const OBJECT_IDX this_o_idx = *it++;
+    const auto o_idx_list = g_ptr->o_idx_list;
+    for (const auto this_o_idx : o_idx_list) {
         auto *o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
         const auto item_name = describe_flavor(player_ptr, o_ptr, 0);
         disturb(player_ptr, false, false);
@@ -7,6 +7,7 @@
 #include "io/signal-handlers.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 #include "term/gameterm.h"
 #include "util/string-processor.h"
 #include "world/world.h"
@@ -118,6 +119,7 @@ static char inkey_aux(void)
         }
     } else {
         (void)(term_inkey(&ch, true, true));
+        TurnProfiler::get_instance().mark_key_input();
     }
 
     if (ch == 30) {
@@ -136,13 +138,13 @@ static char inkey_aux(void)
 
     buf[p++] = ch;
     buf[p] = '\0';
-    k = macro_find_check(buf);
-    if (k < 0) {
+    MacroTriggerCursor cursor;
+    if (!cursor.advance(ch)) {
         return ch;
     }
 
     while (true) {
-        k = macro_find_maybe(buf);
+        k = cursor.find_maybe();
 
         if (k < 0) {
             break;
@@ -151,6 +153,7 @@ static char inkey_aux(void)
         if (0 == term_inkey(&ch, false, true)) {
             buf[p++] = ch;
             buf[p] = '\0';
+            cursor.advance(ch);
             w = 0;
         } else {
             w += 1;
@@ -162,7 +165,7 @@ static char inkey_aux(void)
         }
     }
 
-    k = macro_find_ready(buf);
+    k = cursor.find_ready();
     if (k < 0) {
         while (p > 0) {
             if (term_key_push(buf[--p])) {
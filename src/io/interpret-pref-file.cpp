@@ -23,27 +23,41 @@
 #include "util/string-processor.h"
 #include "view/display-messages.h"
 #include "world/world.h"
+#include <string>
+#include <string_view>
+#include <vector>
 
 #define MAX_MACRO_CHARS 16128 // 1つのマクロキー押下で実行可能なコマンド最大数 (エスケープシーケンス含む).
 
 char *histpref_buf = nullptr;
 
+/*!
+ * @brief トークンを整数に変換する
+ * @param token トークン
+ * @return 変換した値
+ * @details strtol() と同様に、10進/16進/8進のいずれの表記も受け付ける.
+ */
+static long token_to_long(std::string_view token)
+{
+    return strtol(std::string(token).data(), nullptr, 0);
+}
+
 /*!
  * @brief Rトークンの解釈 / Process "R:<num>:<a>/<c>" -- attr/char for monster races
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_r_token(char *buf)
+static errr interpret_r_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 3, zz, TOKENIZE_CHECKQUOTE) != 3) {
+    const auto zz = tokenize(line.substr(2), 3, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 3) {
         return 1;
     }
 
     MonsterRaceInfo *r_ptr;
-    int i = (int)strtol(zz[0], nullptr, 0);
-    TERM_COLOR n1 = (TERM_COLOR)strtol(zz[1], nullptr, 0);
-    auto n2 = static_cast<char>(strtol(zz[2], nullptr, 0));
+    int i = (int)token_to_long(zz[0]);
+    TERM_COLOR n1 = (TERM_COLOR)token_to_long(zz[1]);
+    auto n2 = static_cast<char>(token_to_long(zz[2]));
     if (i >= static_cast<int>(monraces_info.size())) {
         return 1;
     }
@@ -61,19 +75,19 @@ static errr interpret_r_token(char *buf)
 
 /*!
  * @brief Kトークンの解釈 / Process "K:<num>:<a>/<c>"  -- attr/char for object kinds
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_k_token(char *buf)
+static errr interpret_k_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 3, zz, TOKENIZE_CHECKQUOTE) != 3) {
+    const auto zz = tokenize(line.substr(2), 3, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 3) {
         return 1;
     }
 
-    int i = (int)strtol(zz[0], nullptr, 0);
-    TERM_COLOR n1 = (TERM_COLOR)strtol(zz[1], nullptr, 0);
-    auto n2 = static_cast<char>(strtol(zz[2], nullptr, 0));
+    int i = (int)token_to_long(zz[0]);
+    TERM_COLOR n1 = (TERM_COLOR)token_to_long(zz[1]);
+    auto n2 = static_cast<char>(token_to_long(zz[2]));
     if (i >= static_cast<int>(baseitems_info.size())) {
         return 1;
     }
@@ -95,11 +109,11 @@ static errr interpret_k_token(char *buf)
  * @param num トークン数
  * @return エラーコード
  */
-static errr decide_feature_type(int i, int num, char **zz)
+static errr decide_feature_type(int i, int num, const std::vector<std::string_view> &zz)
 {
     auto &terrain = TerrainList::get_instance()[static_cast<short>(i)];
-    TERM_COLOR n1 = (TERM_COLOR)strtol(zz[1], nullptr, 0);
-    auto n2 = static_cast<char>(strtol(zz[2], nullptr, 0));
+    TERM_COLOR n1 = (TERM_COLOR)token_to_long(zz[1]);
+    auto n2 = static_cast<char>(token_to_long(zz[2]));
     if (n1 || (!(n2 & 0x80) && n2)) {
         terrain.x_attr[F_LIT_STANDARD] = n1;
     } /* Allow TERM_DARK text */
@@ -127,8 +141,8 @@ static errr decide_feature_type(int i, int num, char **zz)
     case F_LIT_MAX * 2 + 1: {
         /* Use desired lighting */
         for (int j = F_LIT_NS_BEGIN; j < F_LIT_MAX; j++) {
-            n1 = (TERM_COLOR)strtol(zz[j * 2 + 1], nullptr, 0);
-            n2 = static_cast<char>(strtol(zz[j * 2 + 2], nullptr, 0));
+            n1 = (TERM_COLOR)token_to_long(zz[j * 2 + 1]);
+            n2 = static_cast<char>(token_to_long(zz[j * 2 + 2]));
             if (n1 || (!(n2 & 0x80) && n2)) {
                 terrain.x_attr[j] = n1;
             } /* Allow TERM_DARK text */
@@ -146,25 +160,24 @@ static errr decide_feature_type(int i, int num, char **zz)
 
 /*!
  * @brief Fトークンの解釈 / Process "F:<num>:<a>/<c>" -- attr/char for terrain features
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  * @details
  * "F:<num>:<a>/<c>"
  * "F:<num>:<a>/<c>:LIT"
  * "F:<num>:<a>/<c>:<la>/<lc>:<da>/<dc>"
  */
-static errr interpret_f_token(char *buf)
+static errr interpret_f_token(std::string_view line)
 {
-    char *zz[16];
-    int num = tokenize(buf + 2, F_LIT_MAX * 2 + 1, zz, TOKENIZE_CHECKQUOTE);
-
+    const auto zz = tokenize(line.substr(2), F_LIT_MAX * 2 + 1, TOKENIZE_CHECKQUOTE);
+    const auto num = static_cast<int>(zz.size());
     if ((num != 3) && (num != 4) && (num != F_LIT_MAX * 2 + 1)) {
         return 1;
-    } else if ((num == 4) && !streq(zz[3], "LIT")) {
+    } else if ((num == 4) && (zz[3] != "LIT")) {
         return 1;
     }
 
-    int i = (int)strtol(zz[0], nullptr, 0);
+    int i = (int)token_to_long(zz[0]);
     if (i >= static_cast<int>(TerrainList::get_instance().size())) {
         return 1;
     }
@@ -174,19 +187,19 @@ static errr interpret_f_token(char *buf)
 
 /*!
  * @brief Fトークンの解釈 / Process "S:<num>:<a>/<c>" -- attr/char for special things
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_s_token(char *buf)
+static errr interpret_s_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 3, zz, TOKENIZE_CHECKQUOTE) != 3) {
+    const auto zz = tokenize(line.substr(2), 3, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 3) {
         return 1;
     }
 
-    int j = (byte)strtol(zz[0], nullptr, 0);
-    TERM_COLOR n1 = (TERM_COLOR)strtol(zz[1], nullptr, 0);
-    auto n2 = static_cast<char>(strtol(zz[2], nullptr, 0));
+    int j = (byte)token_to_long(zz[0]);
+    TERM_COLOR n1 = (TERM_COLOR)token_to_long(zz[1]);
+    auto n2 = static_cast<char>(token_to_long(zz[2]));
     misc_to_attr[j] = n1;
     misc_to_char[j] = n2;
     return 0;
@@ -194,19 +207,19 @@ static errr interpret_s_token(char *buf)
 
 /*!
  * @brief Uトークンの解釈 / Process "U:<tv>:<a>/<c>" -- attr/char for unaware items
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_u_token(char *buf)
+static errr interpret_u_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 3, zz, TOKENIZE_CHECKQUOTE) != 3) {
+    const auto zz = tokenize(line.substr(2), 3, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 3) {
         return 1;
     }
 
-    const auto tval = i2enum<ItemKindType>(std::stoi(zz[0], nullptr, 0));
-    const auto n1 = static_cast<uint8_t>(std::stoi(zz[1], nullptr, 0));
-    const auto n2 = static_cast<char>(strtol(zz[2], nullptr, 0));
+    const auto tval = i2enum<ItemKindType>(std::stoi(std::string(zz[0]), nullptr, 0));
+    const auto n1 = static_cast<uint8_t>(std::stoi(std::string(zz[1]), nullptr, 0));
+    const auto n2 = static_cast<char>(token_to_long(zz[2]));
     for (auto &baseitem : baseitems_info) {
         if ((baseitem.idx > 0) && (baseitem.bi_key.tval() == tval)) {
             if (n1) {
@@ -224,18 +237,18 @@ static errr interpret_u_token(char *buf)
 
 /*!
  * @brief Eトークンの解釈 / Process "E:<tv>:<a>" -- attribute for inventory objects
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_e_token(char *buf)
+static errr interpret_e_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 2, zz, TOKENIZE_CHECKQUOTE) != 2) {
+    const auto zz = tokenize(line.substr(2), 2, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 2) {
         return 1;
     }
 
-    int j = (byte)strtol(zz[0], nullptr, 0) % 128;
-    TERM_COLOR n1 = (TERM_COLOR)strtol(zz[1], nullptr, 0);
+    int j = (byte)token_to_long(zz[0]) % 128;
+    TERM_COLOR n1 = (TERM_COLOR)token_to_long(zz[1]);
     if (n1) {
         tval_to_attr[j] = n1;
     }
@@ -244,35 +257,35 @@ static errr interpret_e_token(char *buf)
 
 /*!
  * @brief Pトークンの解釈 / Process "P:<str>" -- normal macro
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_p_token(char *buf)
+static errr interpret_p_token(std::string_view line)
 {
     char tmp[1024];
-    text_to_ascii(tmp, buf + 2, sizeof(tmp));
+    text_to_ascii(tmp, std::string(line.substr(2)), sizeof(tmp));
     return macro_add(tmp, macro_buffers.data());
 }
 
 /*!
  * @brief Cトークンの解釈 / Process "C:<str>" -- create keymap
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_c_token(char *buf)
+static errr interpret_c_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 2, zz, TOKENIZE_CHECKQUOTE) != 2) {
+    const auto zz = tokenize(line.substr(2), 2, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 2) {
         return 1;
     }
 
-    int mode = strtol(zz[0], nullptr, 0);
+    int mode = token_to_long(zz[0]);
     if ((mode < 0) || (mode >= KEYMAP_MODES)) {
         return 1;
     }
 
     char tmp[1024];
-    text_to_ascii(tmp, zz[1], sizeof(tmp));
+    text_to_ascii(tmp, std::string(zz[1]), sizeof(tmp));
     if (!tmp[0] || tmp[1]) {
         return 1;
     }
@@ -285,39 +298,39 @@ static errr interpret_c_token(char *buf)
 
 /*!
  * @brief Vトークンの解釈 / Process "V:<num>:<kv>:<rv>:<gv>:<bv>" -- visual info
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  */
-static errr interpret_v_token(char *buf)
+static errr interpret_v_token(std::string_view line)
 {
-    char *zz[16];
-    if (tokenize(buf + 2, 5, zz, TOKENIZE_CHECKQUOTE) != 5) {
+    const auto zz = tokenize(line.substr(2), 5, TOKENIZE_CHECKQUOTE);
+    if (zz.size() != 5) {
         return 1;
     }
 
-    int i = (byte)strtol(zz[0], nullptr, 0);
-    angband_color_table[i][0] = (byte)strtol(zz[1], nullptr, 0);
-    angband_color_table[i][1] = (byte)strtol(zz[2], nullptr, 0);
-    angband_color_table[i][2] = (byte)strtol(zz[3], nullptr, 0);
-    angband_color_table[i][3] = (byte)strtol(zz[4], nullptr, 0);
+    int i = (byte)token_to_long(zz[0]);
+    angband_color_table[i][0] = (byte)token_to_long(zz[1]);
+    angband_color_table[i][1] = (byte)token_to_long(zz[2]);
+    angband_color_table[i][2] = (byte)token_to_long(zz[3]);
+    angband_color_table[i][3] = (byte)token_to_long(zz[4]);
     return 0;
 }
 
 /*!
  * @brief X/Yトークンの解釈
  * @param player_ptr プレイヤーへの参照ポインタ
- * @param buf バッファ
+ * @param line トークン1行
  * @return エラーコード
  * @details
  * Process "X:<str>" -- turn option off
  * Process "Y:<str>" -- turn option on
  */
-static errr interpret_xy_token(PlayerType *player_ptr, char *buf)
+static errr interpret_xy_token(PlayerType *player_ptr, std::string_view line)
 {
     for (int i = 0; option_info[i].o_desc; i++) {
         bool is_option = option_info[i].o_var != nullptr;
         is_option &= option_info[i].o_text != nullptr;
-        is_option &= streq(option_info[i].o_text, buf + 2);
+        is_option = is_option && (line.substr(2) == option_info[i].o_text);
         if (!is_option) {
             continue;
         }
@@ -326,12 +339,12 @@ static errr interpret_xy_token(PlayerType *player_ptr, char *buf)
         int ob = option_info[i].o_bit;
 
         if ((player_ptr->playing || w_ptr->character_xtra) && (OPT_PAGE_BIRTH == option_info[i].o_page) && !w_ptr->wizard) {
-            msg_format(_("初期オプションは変更できません! '%s'", "Birth options can not be changed! '%s'"), buf);
+            msg_format(_("初期オプションは変更できません! '%s'", "Birth options can not be changed! '%s'"), std::string(line).data());
             msg_print(nullptr);
             return 0;
         }
 
-        if (buf[0] == 'X') {
+        if (line[0] == 'X') {
             g_option_flags[os] &= ~(1UL << ob);
             (*option_info[i].o_var) = false;
             return 0;
@@ -342,7 +355,7 @@ static errr interpret_xy_token(PlayerType *player_ptr, char *buf)
         return 0;
     }
 
-    msg_format(_("オプションの名前が正しくありません： %s", "Ignored invalid option: %s"), buf);
+    msg_format(_("オプションの名前が正しくありません： %s", "Ignored invalid option: %s"), std::string(line).data());
     msg_print(nullptr);
     return 0;
 }
@@ -480,7 +493,7 @@ static errr interpret_t_token(char *buf)
  * @brief 設定ファイルの各行から各種テキスト情報を取得する /
  * Parse a sub-file of the "extra info" (format shown below)
  * @param player_ptr プレイヤーへの参照ポインタ
- * @param buf データテキストの参照ポインタ
+ * @param line データテキスト
  * @return エラーコード
  * @details
  * <pre>
@@ -499,48 +512,51 @@ static errr interpret_t_token(char *buf)
  * used for the "nothing" attr/char.
  * </pre>
  */
-errr interpret_pref_file(PlayerType *player_ptr, char *buf)
+errr interpret_pref_file(PlayerType *player_ptr, std::string_view line)
 {
-    if (buf[1] != ':') {
+    if ((line.size() < 2) || (line[1] != ':')) {
         return 1;
     }
 
-    switch (buf[0]) {
+    switch (line[0]) {
     case 'H': {
         /* Process "H:<history>" */
-        add_history_from_pref_line(buf + 2);
+        add_history_from_pref_line(std::string(line.substr(2)).data());
         return 0;
     }
     case 'R':
-        return interpret_r_token(buf);
+        return interpret_r_token(line);
     case 'K':
-        return interpret_k_token(buf);
+        return interpret_k_token(line);
     case 'F':
-        return interpret_f_token(buf);
+        return interpret_f_token(line);
     case 'S':
-        return interpret_s_token(buf);
+        return interpret_s_token(line);
     case 'U':
-        return interpret_u_token(buf);
+        return interpret_u_token(line);
     case 'E':
-        return interpret_e_token(buf);
+        return interpret_e_token(line);
     case 'A': {
         /* Process "A:<str>" -- save an "action" for later */
-        text_to_ascii(macro_buffers.data(), buf + 2, macro_buffers.size());
+        text_to_ascii(macro_buffers.data(), std::string(line.substr(2)), macro_buffers.size());
         return 0;
     }
     case 'P':
-        return interpret_p_token(buf);
+        return interpret_p_token(line);
     case 'C':
-        return interpret_c_token(buf);
+        return interpret_c_token(line);
     case 'V':
-        return interpret_v_token(buf);
+        return interpret_v_token(line);
     case 'X':
     case 'Y':
-        return interpret_xy_token(player_ptr, buf);
+        return interpret_xy_token(player_ptr, line);
     case 'Z':
-        return interpret_z_token(buf) ? 0 : 1;
-    case 'T':
-        return interpret_t_token(buf);
+        return interpret_z_token(line) ? 0 : 1;
+    case 'T': {
+        // マクロ関連の解釈はトークンを書き換えるため、複写してから渡す
+        std::string buf(line);
+        return interpret_t_token(buf.data());
+    }
     default:
         return 1;
     }
@@ -1,11 +1,12 @@
 #pragma once
 
 #include "system/angband.h"
+#include <string_view>
 
 #define HISTPREF_LIMIT 1024
 
 extern char *histpref_buf;
 
 class PlayerType;
-errr interpret_pref_file(PlayerType *player_ptr, char *buf);
+errr interpret_pref_file(PlayerType *player_ptr, std::string_view line);
 void add_history_from_pref_line(concptr t);
@@ -20,6 +20,7 @@
 #include "util/angband-files.h"
 #include "util/buffer-shaper.h"
 #include "util/string-processor.h"
+#include "util/text-file-reader.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 #include <algorithm>
@@ -50,39 +51,39 @@ static int auto_dump_line_num;
  */
 static errr process_pref_file_aux(PlayerType *player_ptr, const std::filesystem::path &name, int preftype)
 {
-    auto *fp = angband_fopen(name, FileOpenMode::READ);
-    if (!fp) {
+    TextFileReader reader(name);
+    if (!reader.is_open()) {
         return -1;
     }
 
     int line = -1;
     errr err = 0;
     bool bypass = false;
-    std::vector<char> file_read_buf(FILE_READ_BUFF_SIZE);
+    std::string file_read_buf;
     std::string error_line;
-    while (angband_fgets(fp, file_read_buf.data(), file_read_buf.size()) == 0) {
+    while (const auto read_line = reader.read_line()) {
         line++;
-        if (!file_read_buf[0]) {
+        if (read_line->empty()) {
             continue;
         }
 
 #ifdef JP
-        if (!iskanji(file_read_buf[0]))
+        if (!iskanji(read_line->front()))
 #endif
-            if (iswspace(file_read_buf[0])) {
+            if (iswspace(read_line->front())) {
                 continue;
             }
 
-        if (file_read_buf[0] == '#') {
+        if (read_line->starts_with('#')) {
             continue;
         }
-        error_line = file_read_buf.data();
 
         /* Process "?:<expr>" */
-        if ((file_read_buf[0] == '?') && (file_read_buf[1] == ':')) {
+        if (read_line->starts_with("?:")) {
+            // 条件式の評価は文字列を書き換えるため、複写してから渡す
+            file_read_buf = read_line->substr(2);
             char f;
-            char *s;
-            s = file_read_buf.data() + 2;
+            char *s = file_read_buf.data();
             concptr v = process_pref_file_expr(player_ptr, &s, &f);
             bypass = streq(v, "0");
             continue;
@@ -93,22 +94,23 @@ static errr process_pref_file_aux(PlayerType *player_ptr, const std::filesystem:
         }
 
         /* Process "%:<file>" */
-        if (file_read_buf[0] == '%') {
+        if (read_line->starts_with('%')) {
             static int depth_count = 0;
             if (depth_count > 20) {
                 continue;
             }
 
             depth_count++;
+            const auto file_name = read_line->substr(std::min<size_t>(2, read_line->size()));
             switch (preftype) {
             case PREF_TYPE_AUTOPICK:
-                (void)process_autopick_file(player_ptr, file_read_buf.data() + 2);
+                (void)process_autopick_file(player_ptr, file_name);
                 break;
             case PREF_TYPE_HISTPREF:
-                (void)process_histpref_file(player_ptr, file_read_buf.data() + 2);
+                (void)process_histpref_file(player_ptr, file_name);
                 break;
             default:
-                (void)process_pref_file(player_ptr, file_read_buf.data() + 2);
+                (void)process_pref_file(player_ptr, file_name);
                 break;
             }
 
@@ -116,12 +118,14 @@ static errr process_pref_file_aux(PlayerType *player_ptr, const std::filesystem:
             continue;
         }
 
-        err = interpret_pref_file(player_ptr, file_read_buf.data());
+        err = interpret_pref_file(player_ptr, *read_line);
         if (err != 0) {
             if (preftype != PREF_TYPE_AUTOPICK) {
+                error_line = *read_line;
                 break;
             }
 
+            file_read_buf = *read_line;
             process_autopick_file_command(file_read_buf.data());
             err = 0;
         }
@@ -136,7 +140,6 @@ static errr process_pref_file_aux(PlayerType *player_ptr, const std::filesystem:
         msg_print(nullptr);
     }
 
-    angband_fclose(fp);
     return err;
 }
 
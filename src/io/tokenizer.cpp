@@ -1,4 +1,5 @@
 #include "io/tokenizer.h"
+#include <algorithm>
 
 /*!
  * @brief 各種データテキストをトークン単位に分解する / Extract the first few "tokens" from a buffer
@@ -61,3 +62,61 @@ int16_t tokenize(char *buf, int16_t num, char **tokens, BIT_FLAGS mode)
     tokens[i++] = s;
     return i;
 }
+
+/*!
+ * @brief 各種データテキストを、元の文字列を書き換えずにトークン単位に分解する
+ * @param buf データテキスト
+ * @param num トークンの最大数
+ * @param mode オプション
+ * @return トークン群 (bufの部分文字列)
+ * @details 区切り方は tokenize(char *, int16_t, char **, BIT_FLAGS) と同一.
+ * ただし TOKENIZE_CHECKQUOTE で閉じ引用符が欠けている場合、その位置の文字を引用符に書き換えることはしない.
+ */
+std::vector<std::string_view> tokenize(std::string_view buf, size_t num, BIT_FLAGS mode)
+{
+    std::vector<std::string_view> tokens;
+    size_t s = 0;
+    while (tokens.size() + 1 < num) {
+        auto t = s;
+        for (; t < buf.size(); t++) {
+            if ((buf[t] == ':') || (buf[t] == '/')) {
+                break;
+            }
+
+            if ((mode & TOKENIZE_CHECKQUOTE) && (buf[t] == '\'')) {
+                t++;
+                if ((t < buf.size()) && (buf[t] == '\\')) {
+                    t++;
+                }
+
+                if (t >= buf.size()) {
+                    break;
+                }
+
+                t++;
+                if (t >= buf.size()) {
+                    break;
+                }
+
+                continue;
+            }
+
+            if (buf[t] == '\\') {
+                t++;
+                if (t >= buf.size()) {
+                    break;
+                }
+            }
+        }
+
+        if (t >= buf.size()) {
+            break;
+        }
+
+        tokens.push_back(buf.substr(s, t - s));
+        s = t + 1;
+    }
+
+    tokens.push_back(buf.substr(std::min(s, buf.size())));
+    return tokens;
+}
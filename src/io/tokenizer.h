@@ -1,7 +1,10 @@
 #pragma once
 
 #include "system/angband.h"
+#include <string_view>
+#include <vector>
 
 #define TOKENIZE_CHECKQUOTE 0x01 /* Special handling of single quotes */
 
 int16_t tokenize(char *buf, int16_t num, char **tokens, BIT_FLAGS mode);
+std::vector<std::string_view> tokenize(std::string_view buf, size_t num, BIT_FLAGS mode = 0);
@@ -111,6 +111,8 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /*
  * Available graphic modes
@@ -1016,7 +1018,8 @@ struct term_data {
     std::unique_ptr<infowin> win;
 #ifndef USE_XFT
     XImage *tiles;
-    XImage *TmpImage;
+    XImage *RowImage; //!< 1回の描画要求分のタイルを並べてから転送するための画像
+    std::unordered_map<uint64_t, std::vector<unsigned long>> composited_tiles; //!< 前景の透過部分に背景を合成済みのタイル
 #endif
 };
 }
@@ -2055,65 +2058,151 @@ static errr game_term_text_x11(TERM_LEN x, TERM_LEN y, int n, TERM_COLOR a, conc
 }
 
 #ifndef USE_XFT
-/*
- * Draw some graphical characters.
+/*!
+ * @brief 前景タイルの透過色の部分に背景タイルを合成した画素列を返す
+ * @param td 端末データへの参照ポインタ
+ * @param x1 前景タイルのX座標 (ピクセル)
+ * @param y1 前景タイルのY座標 (ピクセル)
+ * @param x2 背景タイルのX座標 (ピクセル)
+ * @param y2 背景タイルのY座標 (ピクセル)
+ * @return 合成したタイルの画素 (行優先)
+ * @details 画面の再描画毎に同じ組を XGetPixel() で合成し直さないよう、タイルの組毎に結果を保持する.
+ */
+static const std::vector<unsigned long> &get_composited_tile(term_data *td, int x1, int y1, int x2, int y2)
+{
+    const auto key = (static_cast<uint64_t>(x1) << 48) | (static_cast<uint64_t>(y1) << 32) | (static_cast<uint64_t>(x2) << 16) | static_cast<uint64_t>(y2);
+    auto [it, is_new] = td->composited_tiles.try_emplace(key);
+    auto &pixels = it->second;
+    if (!is_new) {
+        return pixels;
+    }
+
+    const auto blank = XGetPixel(td->tiles, 0, td->fnt->hgt * 6);
+    pixels.reserve(td->fnt->twid * td->fnt->hgt);
+    for (auto l = 0; l < td->fnt->hgt; l++) {
+        for (auto k = 0; k < td->fnt->twid; k++) {
+            auto pixel = XGetPixel(td->tiles, x1 + k, y1 + l);
+            if (pixel == blank) {
+                pixel = XGetPixel(td->tiles, x2 + k, y2 + l);
+            }
+
+            pixels.push_back(pixel);
+        }
+    }
+
+    return pixels;
+}
+
+/*!
+ * @brief タイル画像の一部を行転送用の画像へ複写する
+ * @details 画素形式が同じならば行単位でまとめて複写する.
  */
-static errr game_term_pict_x11(TERM_LEN x, TERM_LEN y, int n, const TERM_COLOR *ap, const char *cp, const TERM_COLOR *tap, const char *tcp)
+static void copy_tile(const XImage *src, int sx, int sy, XImage *dst, int dx, int width, int height)
 {
-    int i, x1, y1;
+    const auto bpp = src->bits_per_pixel;
+    const auto can_copy_rows = (bpp == dst->bits_per_pixel) && (bpp % 8 == 0) && (src->byte_order == dst->byte_order);
+    for (auto l = 0; l < height; l++) {
+        if (can_copy_rows) {
+            const auto bytes = bpp / 8;
+            std::copy_n(src->data + (sy + l) * src->bytes_per_line + sx * bytes, width * bytes, dst->data + l * dst->bytes_per_line + dx * bytes);
+            continue;
+        }
 
-    TERM_COLOR a;
-    char c;
+        for (auto k = 0; k < width; k++) {
+            XPutPixel(dst, dx + k, l, XGetPixel(const_cast<XImage *>(src), sx + k, sy + l));
+        }
+    }
+}
 
-    TERM_COLOR ta;
-    char tc;
+/*!
+ * @brief 行転送用の画像を、指定した幅以上の大きさで用意する
+ * @return 用意できたらtrue
+ */
+static bool prepare_row_image(term_data *td, int width)
+{
+    if ((td->RowImage != nullptr) && (td->RowImage->width >= width)) {
+        return true;
+    }
 
-    int x2, y2;
-    int k, l;
+    if (td->RowImage != nullptr) {
+        XDestroyImage(td->RowImage);
+    }
 
-    unsigned long pixel, blank;
+    auto *dpy = Metadpy->dpy;
+    const auto screen = DefaultScreen(dpy);
+    td->RowImage = XCreateImage(dpy, DefaultVisual(dpy, screen), DefaultDepth(dpy, screen), ZPixmap, 0, nullptr, width, td->fnt->hgt, 32, 0);
+    if (td->RowImage == nullptr) {
+        return false;
+    }
 
+    td->RowImage->data = static_cast<char *>(malloc(td->RowImage->bytes_per_line * td->fnt->hgt));
+    if (td->RowImage->data == nullptr) {
+        XDestroyImage(td->RowImage);
+        td->RowImage = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Draw some graphical characters.
+ * 連続するタイルは行転送用の画像に並べ、XPutImage() 1回でまとめて転送する.
+ */
+static errr game_term_pict_x11(TERM_LEN x, TERM_LEN y, int n, const TERM_COLOR *ap, const char *cp, const TERM_COLOR *tap, const char *tcp)
+{
     term_data *td = (term_data *)(game_term->data);
+    if (!prepare_row_image(td, n * td->fnt->wid + td->fnt->twid)) {
+        return -1;
+    }
 
     y *= Infofnt->hgt;
     x *= Infofnt->wid;
 
     y += Infowin->oy;
     x += Infowin->ox;
-    for (i = 0; i < n; ++i, x += td->fnt->wid) {
-        a = *ap++;
-        c = *cp++;
-        x1 = (c & 0x7F) * td->fnt->twid;
-        y1 = (a & 0x7F) * td->fnt->hgt;
+
+    auto run_x = x;
+    auto run_width = 0;
+    const auto flush_run = [&]() {
+        if (run_width > 0) {
+            XPutImage(Metadpy->dpy, td->win->win, clr[0]->gc, td->RowImage, 0, 0, run_x, y, run_width, td->fnt->hgt);
+        }
+    };
+
+    for (auto i = 0; i < n; ++i, x += td->fnt->wid) {
+        const auto a = *ap++;
+        const auto c = *cp++;
+        const auto x1 = (c & 0x7F) * td->fnt->twid;
+        const auto y1 = (a & 0x7F) * td->fnt->hgt;
         if (td->tiles->width < x1 + td->fnt->wid || td->tiles->height < y1 + td->fnt->hgt) {
+            flush_run();
             XFillRectangle(Metadpy->dpy, td->win->win, clr[0]->gc, x, y, td->fnt->twid, td->fnt->hgt);
+            run_x = x + td->fnt->wid;
+            run_width = 0;
             continue;
         }
 
-        ta = *tap++;
-        tc = *tcp++;
-
-        x2 = (tc & 0x7F) * td->fnt->twid;
-        y2 = (ta & 0x7F) * td->fnt->hgt;
-
+        const auto ta = *tap++;
+        const auto tc = *tcp++;
+        const auto x2 = (tc & 0x7F) * td->fnt->twid;
+        const auto y2 = (ta & 0x7F) * td->fnt->hgt;
+        const auto dx = x - run_x;
         if (((x1 == x2) && (y1 == y2)) || !(((byte)ta & 0x80) && ((byte)tc & 0x80)) || td->tiles->width < x2 + td->fnt->wid || td->tiles->height < y2 + td->fnt->hgt) {
-            XPutImage(Metadpy->dpy, td->win->win, clr[0]->gc, td->tiles, x1, y1, x, y, td->fnt->twid, td->fnt->hgt);
+            copy_tile(td->tiles, x1, y1, td->RowImage, dx, td->fnt->twid, td->fnt->hgt);
         } else {
-            blank = XGetPixel(td->tiles, 0, td->fnt->hgt * 6);
-            for (k = 0; k < td->fnt->twid; k++) {
-                for (l = 0; l < td->fnt->hgt; l++) {
-                    if ((pixel = XGetPixel(td->tiles, x1 + k, y1 + l)) == blank) {
-                        pixel = XGetPixel(td->tiles, x2 + k, y2 + l);
-                    }
-
-                    XPutPixel(td->TmpImage, k, l, pixel);
+            const auto &pixels = get_composited_tile(td, x1, y1, x2, y2);
+            for (auto l = 0; l < td->fnt->hgt; l++) {
+                for (auto k = 0; k < td->fnt->twid; k++) {
+                    XPutPixel(td->RowImage, dx + k, l, pixels[l * td->fnt->twid + k]);
                 }
             }
-
-            XPutImage(Metadpy->dpy, td->win->win, clr[0]->gc, td->TmpImage, 0, 0, x, y, td->fnt->twid, td->fnt->hgt);
         }
+
+        run_width = dx + td->fnt->twid;
     }
 
+    flush_run();
     s_ptr->drawn = false;
     return 0;
 }
@@ -2454,8 +2543,6 @@ errr init_x11(int argc, char *argv[])
 #ifndef USE_XFT
     int pict_wid = 0;
     int pict_hgt = 0;
-
-    char *TmpData;
 #endif
 
     for (i = 1; i < argc; i++) {
@@ -2614,22 +2701,6 @@ errr init_x11(int argc, char *argv[])
             t->higher_pict = true;
             td->tiles = ResizeImage(dpy, tiles_raw, pict_wid, pict_hgt, td->fnt->twid, td->fnt->hgt);
         }
-
-        for (i = 0; i < num_term; i++) {
-            term_data *td = &data[i];
-            int ii, jj;
-            int depth = DefaultDepth(dpy, DefaultScreen(dpy));
-            Visual *visual = DefaultVisual(dpy, DefaultScreen(dpy));
-            int total;
-            ii = 1;
-            jj = (depth - 1) >> 2;
-            while (jj >>= 1) {
-                ii <<= 1;
-            }
-            total = td->fnt->twid * td->fnt->hgt * ii;
-            TmpData = (char *)malloc(total);
-            td->TmpImage = XCreateImage(dpy, visual, depth, ZPixmap, 0, TmpData, td->fnt->twid, td->fnt->hgt, 8, 0);
-        }
     }
 #endif /* ! USE_XFT */
     return 0;
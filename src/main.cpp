@@ -26,10 +26,13 @@
 #include "util/angband-files.h"
 #include "util/string-processor.h"
 #include "view/display-scores.h"
+#include "wizard/monster-melee-simulator.h"
 #include "wizard/spoiler-util.h"
 #include "wizard/wizard-spoiler.h"
+#include <charconv>
 #include <filesystem>
 #include <string>
+#include <string_view>
 
 /*
  * Available graphic modes
@@ -180,6 +183,10 @@ static void display_usage(const char *program)
     puts("  -d<def>  Define a 'lib' dir sub-path");
     puts("  --output-spoilers");
     puts("           Output auto generated spoilers and exit");
+    puts("  --output-melee-simulation");
+    puts("           Output monster melee simulation (mon-melee-sim.csv) and exit");
+    puts("  --monster-lod-radius=<num>");
+    puts("           Let monsters farther than <num> grids and out of sight skip their moves");
     puts("");
 
 #ifdef USE_X11
@@ -212,17 +219,34 @@ static void display_usage(const char *program)
  * @brief 2文字以上のコマンドライン引数 (オプション)を実行する
  * @param opt コマンドライン引数
  * @return Usageを表示する必要があるか否か
- * @details v3.0.0 Alpha21時点では、スポイラー出力モードの判定及び実行を行う
+ * @details --monster-lod-radius=<num> の場合はモンスターの処理を簡略化する距離を設定する.
+ * <num> が0以上の整数でなければ設定せずにUsageを表示させる.
+ * それ以外はスポイラー出力モード及びモンスター打撃シミュレーションモードの判定及び実行を行う.
  */
 static bool parse_long_opt(const char *opt)
 {
-    if (strcmp(opt + 2, "output-spoilers") != 0) {
+    const std::string_view name(opt + 2);
+    constexpr std::string_view lod_radius_opt = "monster-lod-radius=";
+    if (name.starts_with(lod_radius_opt)) {
+        const auto value = name.substr(lod_radius_opt.size());
+        auto radius = 0;
+        const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), radius);
+        if ((error != std::errc()) || (end != value.data() + value.size()) || (radius < 0)) {
+            return true;
+        }
+
+        arg_monster_lod_radius = radius;
+        return false;
+    }
+
+    if ((name != "output-spoilers") && (name != "output-melee-simulation")) {
         return true;
     }
 
     init_stuff();
     init_angband(p_ptr, true);
-    switch (output_all_spoilers()) {
+    const auto status = (name == "output-spoilers") ? output_all_spoilers() : spoil_mon_melee_simulation();
+    switch (status) {
     case SpoilerOutputResultType::SUCCESSFUL:
         puts("Successfully created a spoiler file.");
         quit(nullptr);
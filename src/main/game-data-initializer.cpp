@@ -50,11 +50,16 @@ void init_other(PlayerType *player_ptr)
     player_ptr->current_floor_ptr = &floor_info; // TODO:本当はこんなところで初期化したくない
     auto *floor_ptr = player_ptr->current_floor_ptr;
     floor_ptr->o_list.assign(w_ptr->max_o_idx, {});
+    floor_ptr->o_feeling_list.assign(w_ptr->max_o_idx, {});
     floor_ptr->m_list.assign(w_ptr->max_m_idx, {});
     for (auto &list : floor_ptr->mproc_list) {
         list.assign(w_ptr->max_m_idx, {});
     }
 
+    for (auto &positions : floor_ptr->mproc_pos) {
+        positions.assign(w_ptr->max_m_idx, -1);
+    }
+
     max_dlv.assign(dungeons_info.size(), {});
     floor_ptr->grid_array.assign(MAX_HGT, std::vector<Grid>(MAX_WID));
     init_gf_colors();
@@ -35,6 +35,7 @@
 #include "system/terrain-type-definition.h"
 #include "util/angband-files.h"
 #include "util/string-processor.h"
+#include "util/text-file-reader.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 #include <fstream>
@@ -97,8 +98,8 @@ template <typename InfoType>
 static errr init_info(std::string_view filename, angband_header &head, InfoType &info, Parser parser, Retoucher retouch = nullptr)
 {
     const auto &path = path_build(ANGBAND_DIR_EDIT, filename);
-    auto *fp = angband_fopen(path, FileOpenMode::READ);
-    if (!fp) {
+    TextFileReader reader(path);
+    if (!reader.is_open()) {
         quit_fmt(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), filename.data());
     }
 
@@ -108,9 +109,7 @@ static errr init_info(std::string_view filename, angband_header &head, InfoType
         info.assign(head.info_num, value_type{});
     }
 
-    char buf[1024]{};
-    const auto &[error_code, error_line] = init_info_txt(fp, buf, &head, parser);
-    angband_fclose(fp);
+    const auto &[error_code, error_line, line] = init_info_txt(reader, &head, parser);
     if (error_code != PARSE_ERROR_NONE) {
         const auto oops = (((error_code > 0) && (error_code < PARSE_ERROR_MAX)) ? err_str[error_code] : _("未知の", "unknown"));
 #ifdef JP
@@ -119,7 +118,7 @@ static errr init_info(std::string_view filename, angband_header &head, InfoType
         msg_format("Error %d at line %d of '%s'.", error_code, error_line, filename.data());
 #endif
         msg_format(_("レコード %d は '%s' エラーがあります。", "Record %d contains a '%s' error."), error_idx, oops);
-        msg_format(_("構文 '%s'。", "Parsing '%s'."), buf);
+        msg_format(_("構文 '%s'。", "Parsing '%s'."), std::string(line).data());
         msg_print(nullptr);
         quit_fmt(_("'%s'ファイルにエラー", "Error in '%s' file."), filename.data());
     }
@@ -229,7 +228,7 @@ errr init_monster_race_definitions()
 errr init_vaults_info()
 {
     init_header(&vaults_header);
-    return init_info("VaultDefinitions.txt", vaults_header, vaults_info, parse_vaults_info);
+    return init_info("VaultDefinitions.txt", vaults_header, vaults_info, parse_vaults_info, retouch_vaults_info);
 }
 
 static bool read_wilderness_definition(std::ifstream &ifs)
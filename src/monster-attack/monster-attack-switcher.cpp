@@ -332,6 +332,17 @@ static void calc_blow_hungry(PlayerType *player_ptr, MonsterAttackPlayer *monap_
     process_monster_attack_hungry(player_ptr, monap_ptr);
 }
 
+/*!
+ * @brief AC軽減ありの打撃によるダメージをプレイヤーのACで軽減する
+ * @param damage 軽減前のダメージ
+ * @param ac プレイヤーのAC
+ * @return 軽減後のダメージ
+ */
+int reduce_blow_damage_by_ac(int damage, int ac)
+{
+    return damage - (damage * ((ac < 150) ? ac : 150) / 250);
+}
+
 void switch_monster_blow_to_player(PlayerType *player_ptr, MonsterAttackPlayer *monap_ptr)
 {
     switch (monap_ptr->effect) {
@@ -342,7 +353,7 @@ void switch_monster_blow_to_player(PlayerType *player_ptr, MonsterAttackPlayer *
         break;
     case RaceBlowEffectType::SUPERHURT: { /* AC軽減あり / Player armor reduces total damage */
         if (((randint1(monap_ptr->rlev * 2 + 300) > (monap_ptr->ac + 200)) || one_in_(13)) && !check_multishadow(player_ptr)) {
-            monap_ptr->damage -= (monap_ptr->damage * ((monap_ptr->ac < 150) ? monap_ptr->ac : 150) / 250);
+            monap_ptr->damage = reduce_blow_damage_by_ac(monap_ptr->damage, monap_ptr->ac);
             msg_print(_("痛恨の一撃！", "It was a critical hit!"));
             monap_ptr->damage = std::max(monap_ptr->damage, monap_ptr->damage * 2);
             monap_ptr->get_damage += take_hit(player_ptr, DAMAGE_ATTACK, monap_ptr->damage, monap_ptr->ddesc);
@@ -352,7 +363,7 @@ void switch_monster_blow_to_player(PlayerType *player_ptr, MonsterAttackPlayer *
         [[fallthrough]];
     case RaceBlowEffectType::HURT: { /* AC軽減あり / Player armor reduces total damage */
         monap_ptr->obvious = true;
-        monap_ptr->damage -= (monap_ptr->damage * ((monap_ptr->ac < 150) ? monap_ptr->ac : 150) / 250);
+        monap_ptr->damage = reduce_blow_damage_by_ac(monap_ptr->damage, monap_ptr->ac);
         monap_ptr->get_damage += take_hit(player_ptr, DAMAGE_ATTACK, monap_ptr->damage, monap_ptr->ddesc);
         break;
     }
@@ -483,7 +494,7 @@ void switch_monster_blow_to_player(PlayerType *player_ptr, MonsterAttackPlayer *
         break;
     case RaceBlowEffectType::SHATTER: { /* AC軽減あり / Player armor reduces total damage */
         monap_ptr->obvious = true;
-        monap_ptr->damage -= (monap_ptr->damage * ((monap_ptr->ac < 150) ? monap_ptr->ac : 150) / 250);
+        monap_ptr->damage = reduce_blow_damage_by_ac(monap_ptr->damage, monap_ptr->ac);
         monap_ptr->get_damage += take_hit(player_ptr, DAMAGE_ATTACK, monap_ptr->damage, monap_ptr->ddesc);
         if (monap_ptr->damage > 23 || monap_ptr->explode) {
             earthquake(player_ptr, monap_ptr->m_ptr->fy, monap_ptr->m_ptr->fx, 8, monap_ptr->m_idx);
@@ -2,4 +2,5 @@
 
 class MonsterAttackPlayer;
 class PlayerType;
+int reduce_blow_damage_by_ac(int damage, int ac);
 void switch_monster_blow_to_player(PlayerType *player_ptr, MonsterAttackPlayer *monap_ptr);
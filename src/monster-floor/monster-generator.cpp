@@ -34,10 +34,12 @@
 #include "system/monster-race-info.h"
 #include "system/player-type-definition.h"
 #include "target/projection-path-calculator.h"
+#include "util/enum-converter.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
 #include "wizard/wizard-messages.h"
 #include <optional>
+#include <vector>
 
 #define MON_SCAT_MAXD 10 /*!< mon_scatter()関数によるモンスター配置で許される中心からの最大距離 */
 
@@ -55,6 +57,13 @@ static MonsterRaceId place_monster_idx = MonsterRace::empty_id();
  */
 static MONSTER_IDX place_monster_m_idx = 0;
 
+/*!
+ * @var place_monster_escorts
+ * @brief 護衛対象のモンスターの護衛となれるか否かの一覧 (モンスター種族IDを添字とする)
+ * @details 護衛を1体選ぶ毎に全種族を判定し直さずに済むよう、護衛対象1体につき1度だけ求める.
+ */
+static std::vector<bool> place_monster_escorts;
+
 /*!
  * @brief モンスター1体を目標地点に可能な限り近い位置に生成する / improved version of scatter() for place monster
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -233,17 +242,18 @@ static bool place_monster_group(PlayerType *player_ptr, MONSTER_IDX who, POSITIO
 }
 
 /*!
- * @brief モンスター種族が召喚主の護衛となれるかどうかをチェックする / Hack -- help pick an escort type
+ * @brief モンスター種族が召喚主の護衛となれるかどうかを判定する
  * @param r_idx チェックするモンスター種族のID
+ * @param is_leader_dungeon 護衛対象の種族がダンジョンに生成され得るか
  * @return 護衛にできるならばtrue
  */
-static bool place_monster_can_escort(PlayerType *player_ptr, MonsterRaceId r_idx)
+static bool judge_escort(PlayerType *player_ptr, MonsterRaceId r_idx, bool is_leader_dungeon)
 {
     auto *r_ptr = &monraces_info[place_monster_idx];
     auto *m_ptr = &player_ptr->current_floor_ptr->m_list[place_monster_m_idx];
     MonsterRaceInfo *z_ptr = &monraces_info[r_idx];
 
-    if (mon_hook_dungeon(player_ptr, place_monster_idx) != mon_hook_dungeon(player_ptr, r_idx)) {
+    if (is_leader_dungeon != mon_hook_dungeon(player_ptr, r_idx)) {
         return false;
     }
 
@@ -280,6 +290,30 @@ static bool place_monster_can_escort(PlayerType *player_ptr, MonsterRaceId r_idx
     return true;
 }
 
+/*!
+ * @brief 現在の護衛対象について、全種族が護衛となれるかどうかを求めておく
+ * @details 判定は護衛対象と各種族の能力のみに依存し、護衛の生成位置には依存しない.
+ */
+static void prepare_escorts(PlayerType *player_ptr)
+{
+    const auto is_leader_dungeon = mon_hook_dungeon(player_ptr, place_monster_idx);
+    place_monster_escorts.assign(monraces_info.size(), false);
+    for (const auto &[r_idx, r_ref] : monraces_info) {
+        place_monster_escorts[enum2i(r_idx)] = judge_escort(player_ptr, r_idx, is_leader_dungeon);
+    }
+}
+
+/*!
+ * @brief モンスター種族が召喚主の護衛となれるかどうかをチェックする / Hack -- help pick an escort type
+ * @param r_idx チェックするモンスター種族のID
+ * @return 護衛にできるならばtrue
+ * @details 事前に prepare_escorts() を呼んでおくこと.
+ */
+static bool place_monster_can_escort([[maybe_unused]] PlayerType *player_ptr, MonsterRaceId r_idx)
+{
+    return place_monster_escorts[enum2i(r_idx)];
+}
+
 /*!
  * @brief 特定モンスターを生成する
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -338,17 +372,22 @@ bool place_specific_monster(PlayerType *player_ptr, MONSTER_IDX who, POSITION y,
         return true;
     }
 
+    /* 護衛の候補となる種族と位置は護衛対象毎に1度だけ求め、32回の試行で使い回す */
     place_monster_idx = r_idx;
+    prepare_escorts(player_ptr);
+    const auto candidates = enumerate_scatter_candidates(player_ptr, { y, x }, 3, PROJECT_NONE);
+    if (candidates.empty()) {
+        return true;
+    }
+
     for (int i = 0; i < 32; i++) {
-        POSITION nx, ny, d = 3;
-        MonsterRaceId z;
-        scatter(player_ptr, &ny, &nx, y, x, d, PROJECT_NONE);
+        const auto &[ny, nx] = rand_choice(candidates);
         if (!is_cave_empty_bold2(player_ptr, ny, nx)) {
             continue;
         }
 
         get_mon_num_prep(player_ptr, place_monster_can_escort, get_monster_hook2(player_ptr, ny, nx));
-        z = get_mon_num(player_ptr, 0, r_ptr->level, 0);
+        const auto z = get_mon_num(player_ptr, 0, r_ptr->level, 0);
         if (!MonsterRace(z).is_valid()) {
             break;
         }
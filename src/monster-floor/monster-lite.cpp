@@ -24,6 +24,59 @@
 #include "world/world.h"
 #include <vector>
 
+namespace {
+/*!
+ * @brief モンスター種族毎の光源情報
+ * @details 明暗フラグは種族定義の読込後に変化しないため、種族毎に一度だけ半径と符号を計算しておく.
+ */
+struct MonsterLightSource {
+    int rad = 0; //!< 光源半径 (負なら暗闇)
+    bool is_self = false; //!< 寝ている時や昼間でも明暗を持つか否か
+};
+
+MonsterLightSource make_monster_light_source(const MonsterRaceInfo &monrace)
+{
+    MonsterLightSource source;
+    const auto &flags = monrace.brightness_flags;
+    if (flags.has_any_of({ MonsterBrightnessType::HAS_LITE_1, MonsterBrightnessType::SELF_LITE_1 })) {
+        source.rad++;
+    }
+
+    if (flags.has_any_of({ MonsterBrightnessType::HAS_LITE_2, MonsterBrightnessType::SELF_LITE_2 })) {
+        source.rad += 2;
+    }
+
+    if (flags.has_any_of({ MonsterBrightnessType::HAS_DARK_1, MonsterBrightnessType::SELF_DARK_1 })) {
+        source.rad--;
+    }
+
+    if (flags.has_any_of({ MonsterBrightnessType::HAS_DARK_2, MonsterBrightnessType::SELF_DARK_2 })) {
+        source.rad -= 2;
+    }
+
+    if (source.rad > 0) {
+        source.is_self = flags.has_any_of({ MonsterBrightnessType::SELF_LITE_1, MonsterBrightnessType::SELF_LITE_2 });
+    } else if (source.rad < 0) {
+        source.is_self = flags.has_any_of({ MonsterBrightnessType::SELF_DARK_1, MonsterBrightnessType::SELF_DARK_2 });
+    }
+
+    return source;
+}
+
+const MonsterLightSource &get_monster_light_source(const MonsterRaceInfo &monrace)
+{
+    static std::vector<MonsterLightSource> sources;
+    if (sources.empty()) {
+        sources.resize(monraces_info.empty() ? 0 : static_cast<int>(monraces_info.rbegin()->first) + 1);
+        for (const auto &[monrace_id, race] : monraces_info) {
+            sources[static_cast<int>(monrace_id)] = make_monster_light_source(race);
+        }
+    }
+
+    return sources.at(static_cast<int>(monrace.idx));
+}
+}
+
 /*!
  * @brief モンスターによる光量状態更新 / Add a square to the changes array
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -149,8 +202,9 @@ static void update_monster_dark(
  */
 void update_mon_lite(PlayerType *player_ptr)
 {
-    // 座標たちを記録する配列。
-    std::vector<Pos2D> points;
+    // 座標たちを記録する配列。毎回の再確保を避けるため使い回す.
+    static std::vector<Pos2D> points;
+    points.clear();
 
     void (*add_mon_lite)(PlayerType *, std::vector<Pos2D> &, const POSITION, const POSITION, const monster_lite_type *);
     auto *floor_ptr = player_ptr->current_floor_ptr;
@@ -173,30 +227,15 @@ void update_mon_lite(PlayerType *player_ptr)
                 continue;
             }
 
-            int rad = 0;
-            if (r_ptr->brightness_flags.has_any_of({ MonsterBrightnessType::HAS_LITE_1, MonsterBrightnessType::SELF_LITE_1 })) {
-                rad++;
-            }
-
-            if (r_ptr->brightness_flags.has_any_of({ MonsterBrightnessType::HAS_LITE_2, MonsterBrightnessType::SELF_LITE_2 })) {
-                rad += 2;
-            }
-
-            if (r_ptr->brightness_flags.has_any_of({ MonsterBrightnessType::HAS_DARK_1, MonsterBrightnessType::SELF_DARK_1 })) {
-                rad--;
-            }
-
-            if (r_ptr->brightness_flags.has_any_of({ MonsterBrightnessType::HAS_DARK_2, MonsterBrightnessType::SELF_DARK_2 })) {
-                rad -= 2;
-            }
-
+            const auto &source = get_monster_light_source(*r_ptr);
+            auto rad = source.rad;
             if (!rad) {
                 continue;
             }
 
             TerrainCharacteristics f_flag;
             if (rad > 0) {
-                auto should_lite = r_ptr->brightness_flags.has_none_of({ MonsterBrightnessType::SELF_LITE_1, MonsterBrightnessType::SELF_LITE_2 });
+                auto should_lite = !source.is_self;
                 should_lite &= (m_ptr->is_asleep() || (!floor_ptr->dun_level && w_ptr->is_daytime()) || AngbandSystem::get_instance().is_phase_out());
                 if (should_lite) {
                     continue;
@@ -209,7 +248,7 @@ void update_mon_lite(PlayerType *player_ptr)
                 add_mon_lite = update_monster_lite;
                 f_flag = TerrainCharacteristics::LOS;
             } else {
-                if (r_ptr->brightness_flags.has_none_of({ MonsterBrightnessType::SELF_DARK_1, MonsterBrightnessType::SELF_DARK_2 }) && (m_ptr->is_asleep() || (!floor_ptr->dun_level && !w_ptr->is_daytime()))) {
+                if (!source.is_self && (m_ptr->is_asleep() || (!floor_ptr->dun_level && !w_ptr->is_daytime()))) {
                     continue;
                 }
 
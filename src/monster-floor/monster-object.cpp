@@ -186,10 +186,10 @@ void update_object_by_monster_movement(PlayerType *player_ptr, turn_flags *turn_
     auto *r_ptr = &m_ptr->get_monrace();
     auto *g_ptr = &player_ptr->current_floor_ptr->grid_array[ny][nx];
     turn_flags_ptr->do_take = r_ptr->behavior_flags.has(MonsterBehaviorType::TAKE_ITEM);
-    for (auto it = g_ptr->o_idx_list.begin(); it != g_ptr->o_idx_list.end();) {
+    const auto o_idx_list = g_ptr->o_idx_list;
+    for (const auto this_o_idx : o_idx_list) {
         EnumClassFlagGroup<MonsterKindType> flg_monster_kind;
         EnumClassFlagGroup<MonsterResistanceType> flgr;
-        OBJECT_IDX this_o_idx = *it++;
         auto *o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
 
         if (turn_flags_ptr->do_take) {
@@ -218,11 +218,11 @@ void update_object_by_monster_movement(PlayerType *player_ptr, turn_flags *turn_
  */
 void monster_drop_carried_objects(PlayerType *player_ptr, MonsterEntity *m_ptr)
 {
-    for (auto it = m_ptr->hold_o_idx_list.begin(); it != m_ptr->hold_o_idx_list.end();) {
+    const auto hold_o_idx_list = m_ptr->hold_o_idx_list;
+    for (const auto this_o_idx : hold_o_idx_list) {
         ItemEntity forge;
         ItemEntity *o_ptr;
         ItemEntity *q_ptr;
-        const OBJECT_IDX this_o_idx = *it++;
         o_ptr = &player_ptr->current_floor_ptr->o_list[this_o_idx];
         q_ptr = &forge;
         q_ptr->copy_from(o_ptr);
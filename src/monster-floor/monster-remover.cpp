@@ -82,8 +82,8 @@ void delete_monster_idx(PlayerType *player_ptr, MONSTER_IDX i)
     }
 
     floor_ptr->grid_array[y][x].m_idx = 0;
-    for (auto it = m_ptr->hold_o_idx_list.begin(); it != m_ptr->hold_o_idx_list.end();) {
-        const OBJECT_IDX this_o_idx = *it++;
+    const auto hold_o_idx_list = m_ptr->hold_o_idx_list;
+    for (const auto this_o_idx : hold_o_idx_list) {
         delete_object_idx(player_ptr, this_o_idx);
     }
 
@@ -98,6 +98,7 @@ void delete_monster_idx(PlayerType *player_ptr, MONSTER_IDX i)
 
     *m_ptr = {};
     floor_ptr->m_cnt--;
+    floor_ptr->m_free_list.push_back(i);
     lite_spot(player_ptr, y, x);
     if (r_ptr->brightness_flags.has_any_of(ld_mask)) {
         RedrawingFlagsUpdater::get_instance().set_flag(StatusRecalculatingFlag::MONSTER_LITE);
@@ -134,6 +135,7 @@ void wipe_monsters_list(PlayerType *player_ptr)
 
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
+    floor_ptr->m_free_list.clear();
     for (int i = 0; i < MAX_MTIMED; i++) {
         floor_ptr->mproc_max[i] = 0;
     }
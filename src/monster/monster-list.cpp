@@ -57,10 +57,22 @@
  * @brief モンスター配列の空きを探す / Acquires and returns the index of a "free" monster.
  * @return 利用可能なモンスター配列の添字
  * @details
+ * 削除済の添字を優先して再利用し、配列の末尾を伸ばすのはその後とする (o_pop() と同様).
  * This routine should almost never fail, but it *can* happen.
  */
 MONSTER_IDX m_pop(FloorType *floor_ptr)
 {
+    /* Reuse deleted monsters */
+    auto &free_list = floor_ptr->m_free_list;
+    while (!free_list.empty()) {
+        const auto i = free_list.back();
+        free_list.pop_back();
+        if ((i < floor_ptr->m_max) && !MonsterRace(floor_ptr->m_list[i].r_idx).is_valid()) {
+            floor_ptr->m_cnt++;
+            return i;
+        }
+    }
+
     /* Normal allocation */
     if (floor_ptr->m_max < w_ptr->max_m_idx) {
         MONSTER_IDX i = floor_ptr->m_max;
@@ -19,6 +19,7 @@
 #include "floor/cave.h"
 #include "floor/geometry.h"
 #include "game-option/play-record-options.h"
+#include "game-option/runtime-arguments.h"
 #include "grid/feature.h"
 #include "io/write-diary.h"
 #include "melee/melee-postprocess.h"
@@ -66,6 +67,7 @@
 #include "system/monster-race-info.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 #include "target/projection-path-calculator.h"
 #include "view/display-messages.h"
 
@@ -580,6 +582,7 @@ bool process_monster_fear(PlayerType *player_ptr, turn_flags *turn_flags_ptr, MO
  */
 void process_monsters(PlayerType *player_ptr)
 {
+    TurnProfileScope profile_scope(TurnPhase::PROCESS_MONSTERS);
     const auto old_monrace_id = player_ptr->monster_race_idx;
     old_race_flags tmp_flags(old_monrace_id);
     old_race_flags *old_race_flags_ptr = &tmp_flags;
@@ -593,6 +596,31 @@ void process_monsters(PlayerType *player_ptr)
     update_player_window(player_ptr, old_race_flags_ptr);
 }
 
+/*!
+ * @brief 行動を簡易処理で済ませる遠方のモンスターか判定する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param m_idx モンスターの参照ID
+ * @return 簡易処理で済ませるならTRUE
+ * @details
+ * --monster-lod-radius で指定した距離 (最短でも視界の最大半径) より遠く、プレイヤーの視線が通らないモンスターは
+ * 行動せずにエネルギーだけを消費する. 回復や時限効果の減衰はprocess_world() 側で通常通り行われ、
+ * 指定距離内に入るか視線が通れば通常の処理に戻る.
+ * プレイヤーを追いかけるペットと騎乗中のモンスターは対象外.
+ */
+static bool is_far_monster_to_simplify(PlayerType *player_ptr, MONSTER_IDX m_idx)
+{
+    if (arg_monster_lod_radius <= 0) {
+        return false;
+    }
+
+    const auto &monster = player_ptr->current_floor_ptr->m_list[m_idx];
+    if ((monster.cdis <= std::max(arg_monster_lod_radius, MAX_PLAYER_SIGHT)) || (player_ptr->riding == m_idx) || monster.is_pet()) {
+        return false;
+    }
+
+    return !player_ptr->current_floor_ptr->has_los({ monster.fy, monster.fx });
+}
+
 /*!
  * @brief フロア内のモンスターについてターン終了時の処理を繰り返す
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -628,6 +656,10 @@ void sweep_monster_process(PlayerType *player_ptr)
         }
 
         m_ptr->energy_need += ENERGY_NEED();
+        if (is_far_monster_to_simplify(player_ptr, i)) {
+            continue;
+        }
+
         hack_m_idx = i;
         process_monster(player_ptr, i);
         reset_target(m_ptr);
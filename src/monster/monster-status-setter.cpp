@@ -72,7 +72,10 @@ static void mproc_remove(FloorType *floor_ptr, MONSTER_IDX m_idx, int mproc_type
 {
     int mproc_idx = get_mproc_idx(floor_ptr, m_idx, mproc_type);
     if (mproc_idx >= 0) {
-        floor_ptr->mproc_list[mproc_type][mproc_idx] = floor_ptr->mproc_list[mproc_type][--floor_ptr->mproc_max[mproc_type]];
+        const auto moved_m_idx = floor_ptr->mproc_list[mproc_type][--floor_ptr->mproc_max[mproc_type]];
+        floor_ptr->mproc_list[mproc_type][mproc_idx] = moved_m_idx;
+        floor_ptr->mproc_pos[mproc_type][moved_m_idx] = static_cast<int16_t>(mproc_idx);
+        floor_ptr->mproc_pos[mproc_type][m_idx] = -1;
     }
 }
 
@@ -100,18 +100,18 @@ int mon_damage_mod(PlayerType *player_ptr, MonsterEntity *m_ptr, int dam, bool i
  * @param floor_ptr 現在フロアへの参照ポインタ
  * @return m_idx モンスターの参照ID
  * @return mproc_type モンスターの時限ステータスID
- * @return 残りターン値
+ * @return mproc_list 内の位置. リストになければ-1
+ * @details mproc_list を書き換える度に mproc_pos も更新しているので走査は不要.
+ * mproc_max を0に戻す初期化では mproc_pos を消去しないため、リストの内容と一致するかを確認する.
  */
 int get_mproc_idx(FloorType *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 {
-    const auto &cur_mproc_list = floor_ptr->mproc_list[mproc_type];
-    for (int i = floor_ptr->mproc_max[mproc_type] - 1; i >= 0; i--) {
-        if (cur_mproc_list[i] == m_idx) {
-            return i;
-        }
+    const auto pos = floor_ptr->mproc_pos[mproc_type][m_idx];
+    if ((pos < 0) || (pos >= floor_ptr->mproc_max[mproc_type]) || (floor_ptr->mproc_list[mproc_type][pos] != m_idx)) {
+        return -1;
     }
 
-    return -1;
+    return pos;
 }
 
 /*!
@@ -123,7 +123,9 @@ int get_mproc_idx(FloorType *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 void mproc_add(FloorType *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 {
     if (floor_ptr->mproc_max[mproc_type] < w_ptr->max_m_idx) {
-        floor_ptr->mproc_list[mproc_type][floor_ptr->mproc_max[mproc_type]++] = (int16_t)m_idx;
+        const auto pos = floor_ptr->mproc_max[mproc_type]++;
+        floor_ptr->mproc_list[mproc_type][pos] = (int16_t)m_idx;
+        floor_ptr->mproc_pos[mproc_type][m_idx] = pos;
     }
 }
 
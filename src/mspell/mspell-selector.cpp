@@ -21,165 +21,71 @@
 #include "system/monster-race-info.h"
 #include "system/player-type-definition.h"
 #include "util/enum-converter.h"
+#include "util/flag-group.h"
 #include "world/world.h"
 
 /*!
- * @brief ID値が攻撃魔法のIDかどうかを返す /
- * Return TRUE if a spell is good for hurting the player (directly).
- * @param spell 判定対象のID
- * @return 正しいIDならばTRUEを返す。
- */
-static bool spell_attack(MonsterAbilityType spell)
-{
-    return RF_ABILITY_ATTACK_SPELLS_MASK.has(spell);
-}
-
-/*!
- * @brief ID値が退避目的に適したモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell is good for escaping.
- * @param spell 判定対象のID
- * @return 適した魔法のIDならばTRUEを返す。
- */
-static bool spell_escape(MonsterAbilityType spell)
-{
-    /* Blink or Teleport */
-    if (spell == MonsterAbilityType::BLINK || spell == MonsterAbilityType::TPORT) {
-        return true;
-    }
-
-    /* Teleport the player away */
-    if (spell == MonsterAbilityType::TELE_AWAY || spell == MonsterAbilityType::TELE_LEVEL) {
-        return true;
-    }
-
-    /* Isn't good for escaping */
-    return false;
-}
-
-/*!
- * @brief ID値が妨害目的に適したモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell is good for annoying the player.
- * @param spell 判定対象のID
- * @return 適した魔法のIDならばTRUEを返す。
- */
-static bool spell_annoy(MonsterAbilityType spell)
-{
-    return RF_ABILITY_ANNOY_SPELLS_MASK.has(spell);
-}
-
-/*!
- * @brief ID値が召喚型のモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell is good for annoying the player.
- * @param spell 判定対象のID
- * @return 召喚型魔法のIDならばTRUEを返す。
- */
-static bool spell_summon(MonsterAbilityType spell)
-{
-    return RF_ABILITY_SUMMON_MASK.has(spell);
-}
-
-/*!
- * @brief ID値が死者復活処理かどうかを返す /
- * Return TRUE if a spell is good for annoying the player.
- * @param spell 判定対象のID
- * @return 死者復活の処理ならばTRUEを返す。
- */
-static bool spell_raise(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::RAISE_DEAD;
-}
-
-/*!
- * @brief ID値が戦術的なモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell is good in a tactical situation.
- * @param spell 判定対象のID
- * @return 戦術的な魔法のIDならばTRUEを返す。
- */
-static bool spell_tactic(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::BLINK;
-}
-
-/*!
- * @brief ID値が無敵化するモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell makes invulnerable.
- * @param spell 判定対象のID
- * @return 召喚型魔法のIDならばTRUEを返す。
- */
-static bool spell_invulner(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::INVULNER;
-}
-
-/*!
- * @brief ID値が加速するモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell hastes.
- * @param spell 判定対象のID
- * @return 召喚型魔法のIDならばTRUEを返す。
- */
-static bool spell_haste(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::HASTE;
-}
-
-/*!
- * @brief ID値が時間停止を行うモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell world.
- * @param spell 判定対象のID
- * @return 時間停止魔法のIDならばTRUEを返す。
- */
-static bool spell_world(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::WORLD;
-}
-
-/*!
- * @brief ID値が特別効果のモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell special.
- * @param player_ptr プレイヤーへの参照ポインタ
- * @param spell 判定対象のID
- * @return 特別効果魔法のIDならばTRUEを返す。
- */
-static bool spell_special(MonsterAbilityType spell)
-{
-    if (AngbandSystem::get_instance().is_phase_out()) {
-        return false;
-    }
-
-    return spell == MonsterAbilityType::SPECIAL;
-}
-
-/*!
- * @brief ID値が光の剣のモンスター魔法IDかどうかを返す /
- * Return TRUE if a spell psycho-spear.
- * @param spell 判定対象のID
- * @return 光の剣のIDならばTRUEを返す。
- */
-static bool spell_psy_spe(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::PSY_SPEAR;
-}
-
-/*!
- * @brief ID値が治癒魔法かどうかを返す /
- * Return TRUE if a spell is good for healing.
- * @param spell 判定対象のID
- * @return 治癒魔法のIDならばTRUEを返す。
- */
-static bool spell_heal(MonsterAbilityType spell)
-{
-    return spell == MonsterAbilityType::HEAL;
-}
-
-/*!
- * @brief ID値が魔力消去かどうかを返す /
- * Return TRUE if a spell is good for dispel.
- * @param spell 判定対象のID
- * @return 魔力消去のIDならばTRUEを返す。
+ * @brief 退避目的に適したモンスター魔法 / Spells good for escaping.
+ * @details Blink or Teleport, or teleport the player away.
+ */
+static const EnumClassFlagGroup<MonsterAbilityType> ESCAPE_SPELLS_MASK = {
+    MonsterAbilityType::BLINK,
+    MonsterAbilityType::TPORT,
+    MonsterAbilityType::TELE_AWAY,
+    MonsterAbilityType::TELE_LEVEL,
+};
+
+/*!
+ * @brief 魔法候補を用途別に分類したもの
+ * @details 候補魔法のフラグ集合と用途別のマスクの積を取るだけで分類できる.
+ * 各分類の中での並びはMonsterAbilityTypeの順であり、候補配列 (mspells) の並びと一致する.
+ */
+struct MonsterSpellCategories {
+    MonsterSpellCategories(const EnumClassFlagGroup<MonsterAbilityType> &spells)
+        : escape(spells & ESCAPE_SPELLS_MASK)
+        , attack(spells & RF_ABILITY_ATTACK_SPELLS_MASK)
+        , summon(spells & RF_ABILITY_SUMMON_MASK)
+        , annoy(spells & RF_ABILITY_ANNOY_SPELLS_MASK)
+    {
+        const auto pick = [&spells](MonsterAbilityType spell) {
+            return spells.has(spell) ? EnumClassFlagGroup<MonsterAbilityType>{ spell } : EnumClassFlagGroup<MonsterAbilityType>{};
+        };
+
+        this->tactic = pick(MonsterAbilityType::BLINK);
+        this->invul = pick(MonsterAbilityType::INVULNER);
+        this->haste = pick(MonsterAbilityType::HASTE);
+        this->world = pick(MonsterAbilityType::WORLD);
+        this->special = AngbandSystem::get_instance().is_phase_out() ? EnumClassFlagGroup<MonsterAbilityType>{} : pick(MonsterAbilityType::SPECIAL);
+        this->psy_spe = pick(MonsterAbilityType::PSY_SPEAR);
+        this->raise = pick(MonsterAbilityType::RAISE_DEAD);
+        this->heal = pick(MonsterAbilityType::HEAL);
+        this->dispel = pick(MonsterAbilityType::DISPEL);
+    }
+
+    EnumClassFlagGroup<MonsterAbilityType> escape;
+    EnumClassFlagGroup<MonsterAbilityType> attack;
+    EnumClassFlagGroup<MonsterAbilityType> summon;
+    EnumClassFlagGroup<MonsterAbilityType> annoy;
+    EnumClassFlagGroup<MonsterAbilityType> tactic;
+    EnumClassFlagGroup<MonsterAbilityType> invul;
+    EnumClassFlagGroup<MonsterAbilityType> haste;
+    EnumClassFlagGroup<MonsterAbilityType> world;
+    EnumClassFlagGroup<MonsterAbilityType> special;
+    EnumClassFlagGroup<MonsterAbilityType> psy_spe;
+    EnumClassFlagGroup<MonsterAbilityType> raise;
+    EnumClassFlagGroup<MonsterAbilityType> heal;
+    EnumClassFlagGroup<MonsterAbilityType> dispel;
+};
+
+/*!
+ * @brief 魔法の分類から等確率で1つ選ぶ
+ * @param spells 魔法の分類
+ * @return 選択したモンスター魔法のID
+ * @details 乱数の消費は配列からrand_choice()で選ぶ場合と同一である.
  */
-static bool spell_dispel(MonsterAbilityType spell)
+static MonsterAbilityType rand_choice_spell(const EnumClassFlagGroup<MonsterAbilityType> &spells)
 {
-    return spell == MonsterAbilityType::DISPEL;
+    return *spells.nth(randint0(spells.count()));
 }
 
 /*!
@@ -220,170 +126,103 @@ static bool decide_select_special(MonsterRaceId r_idx)
  * Stupid monsters will just pick a spell randomly.  Smart monsters\n
  * will choose more "intelligently".\n
  *\n
- * Use the helper functions above to put spells into categories.\n
+ * Use the category masks above to put spells into categories.\n
  *\n
  * This function may well be an efficiency bottleneck.\n
  * @todo 長過ぎる。切り分けが必要
  */
 MonsterAbilityType choose_attack_spell(PlayerType *player_ptr, msa_type *msa_ptr)
 {
-    std::vector<MonsterAbilityType> escape;
-    std::vector<MonsterAbilityType> attack;
-    std::vector<MonsterAbilityType> summon;
-    std::vector<MonsterAbilityType> tactic;
-    std::vector<MonsterAbilityType> annoy;
-    std::vector<MonsterAbilityType> invul;
-    std::vector<MonsterAbilityType> haste;
-    std::vector<MonsterAbilityType> world;
-    std::vector<MonsterAbilityType> special;
-    std::vector<MonsterAbilityType> psy_spe;
-    std::vector<MonsterAbilityType> raise;
-    std::vector<MonsterAbilityType> heal;
-    std::vector<MonsterAbilityType> dispel;
-
     auto *m_ptr = &player_ptr->current_floor_ptr->m_list[msa_ptr->m_idx];
     auto *r_ptr = &m_ptr->get_monrace();
     if (r_ptr->flags2 & RF2_STUPID) {
         return rand_choice(msa_ptr->mspells);
     }
 
-    for (size_t i = 0; i < msa_ptr->mspells.size(); i++) {
-        if (spell_escape(msa_ptr->mspells[i])) {
-            escape.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_attack(msa_ptr->mspells[i])) {
-            attack.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_summon(msa_ptr->mspells[i])) {
-            summon.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_tactic(msa_ptr->mspells[i])) {
-            tactic.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_annoy(msa_ptr->mspells[i])) {
-            annoy.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_invulner(msa_ptr->mspells[i])) {
-            invul.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_haste(msa_ptr->mspells[i])) {
-            haste.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_world(msa_ptr->mspells[i])) {
-            world.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_special(msa_ptr->mspells[i])) {
-            special.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_psy_spe(msa_ptr->mspells[i])) {
-            psy_spe.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_raise(msa_ptr->mspells[i])) {
-            raise.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_heal(msa_ptr->mspells[i])) {
-            heal.push_back(msa_ptr->mspells[i]);
-        }
-
-        if (spell_dispel(msa_ptr->mspells[i])) {
-            dispel.push_back(msa_ptr->mspells[i]);
-        }
-    }
-
-    if (!world.empty() && (randint0(100) < 15) && !w_ptr->timewalk_m_idx) {
-        return rand_choice(world);
+    const MonsterSpellCategories spells(msa_ptr->ability_flags);
+    if (spells.world.any() && (randint0(100) < 15) && !w_ptr->timewalk_m_idx) {
+        return rand_choice_spell(spells.world);
     }
 
     const auto &monrace_list = MonraceList::get_instance();
-    if (!special.empty() && monrace_list.can_select_separate(m_ptr->r_idx, m_ptr->hp, m_ptr->maxhp)) {
-        return rand_choice(special);
+    if (spells.special.any() && monrace_list.can_select_separate(m_ptr->r_idx, m_ptr->hp, m_ptr->maxhp)) {
+        return rand_choice_spell(spells.special);
     }
 
     if (m_ptr->hp < m_ptr->maxhp / 3 && one_in_(2)) {
-        if (!heal.empty()) {
-            return rand_choice(heal);
+        if (spells.heal.any()) {
+            return rand_choice_spell(spells.heal);
         }
     }
 
     if (((m_ptr->hp < m_ptr->maxhp / 3) || m_ptr->is_fearful()) && one_in_(2)) {
-        if (!escape.empty()) {
-            return rand_choice(escape);
+        if (spells.escape.any()) {
+            return rand_choice_spell(spells.escape);
         }
     }
 
-    if (!special.empty()) {
+    if (spells.special.any()) {
         const auto r_idx = m_ptr->r_idx;
         auto should_select_special = monrace_list.is_unified(r_idx) && (randint0(100) < 70);
         should_select_special |= decide_select_special(r_idx);
         if (should_select_special) {
-            return rand_choice(special);
+            return rand_choice_spell(spells.special);
         }
     }
 
     auto should_select_tactic = distance(player_ptr->y, player_ptr->x, m_ptr->fy, m_ptr->fx) < 4;
-    should_select_tactic &= !attack.empty() || r_ptr->ability_flags.has(MonsterAbilityType::TRAPS);
+    should_select_tactic &= spells.attack.any() || r_ptr->ability_flags.has(MonsterAbilityType::TRAPS);
     should_select_tactic &= randint0(100) < 75;
     should_select_tactic &= w_ptr->timewalk_m_idx == 0;
-    should_select_tactic &= !tactic.empty();
+    should_select_tactic &= spells.tactic.any();
     if (should_select_tactic) {
-        return rand_choice(tactic);
+        return rand_choice_spell(spells.tactic);
     }
 
-    if (!summon.empty() && (randint0(100) < 40)) {
-        return rand_choice(summon);
+    if (spells.summon.any() && (randint0(100) < 40)) {
+        return rand_choice_spell(spells.summon);
     }
 
-    if (!dispel.empty() && one_in_(2)) {
+    if (spells.dispel.any() && one_in_(2)) {
         if (dispel_check(player_ptr, msa_ptr->m_idx)) {
-            return rand_choice(dispel);
+            return rand_choice_spell(spells.dispel);
         }
     }
 
-    if (!raise.empty() && (randint0(100) < 40)) {
-        return rand_choice(raise);
+    if (spells.raise.any() && (randint0(100) < 40)) {
+        return rand_choice_spell(spells.raise);
     }
 
     if (is_invuln(player_ptr)) {
-        if (!psy_spe.empty() && (randint0(100) < 50)) {
-            return rand_choice(psy_spe);
-        } else if (!attack.empty() && (randint0(100) < 40)) {
-            return rand_choice(attack);
+        if (spells.psy_spe.any() && (randint0(100) < 50)) {
+            return rand_choice_spell(spells.psy_spe);
+        } else if (spells.attack.any() && (randint0(100) < 40)) {
+            return rand_choice_spell(spells.attack);
         }
-    } else if (!attack.empty() && (randint0(100) < 85)) {
-        return rand_choice(attack);
+    } else if (spells.attack.any() && (randint0(100) < 85)) {
+        return rand_choice_spell(spells.attack);
     }
 
-    if (!tactic.empty() && (randint0(100) < 50) && !w_ptr->timewalk_m_idx) {
-        return rand_choice(tactic);
+    if (spells.tactic.any() && (randint0(100) < 50) && !w_ptr->timewalk_m_idx) {
+        return rand_choice_spell(spells.tactic);
     }
 
-    if (!invul.empty() && !m_ptr->mtimed[MTIMED_INVULNER] && (randint0(100) < 50)) {
-        return rand_choice(invul);
+    if (spells.invul.any() && !m_ptr->mtimed[MTIMED_INVULNER] && (randint0(100) < 50)) {
+        return rand_choice_spell(spells.invul);
     }
 
     if ((m_ptr->hp < m_ptr->maxhp * 3 / 4) && (randint0(100) < 25)) {
-        if (!heal.empty()) {
-            return rand_choice(heal);
+        if (spells.heal.any()) {
+            return rand_choice_spell(spells.heal);
         }
     }
 
-    if (!haste.empty() && (randint0(100) < 20) && !m_ptr->is_accelerated()) {
-        return rand_choice(haste);
+    if (spells.haste.any() && (randint0(100) < 20) && !m_ptr->is_accelerated()) {
+        return rand_choice_spell(spells.haste);
     }
 
-    if (!annoy.empty() && (randint0(100) < 80)) {
-        return rand_choice(annoy);
+    if (spells.annoy.any() && (randint0(100) < 80)) {
+        return rand_choice_spell(spells.annoy);
     }
 
     return MonsterAbilityType::MAX;
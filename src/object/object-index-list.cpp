@@ -19,7 +19,7 @@ void ObjectIndexList::add(FloorType *floor_ptr, OBJECT_IDX o_idx, IDX stack_idx)
 
 void ObjectIndexList::remove(OBJECT_IDX o_idx)
 {
-    o_idx_list_.remove(o_idx);
+    std::erase(o_idx_list_, o_idx);
 }
 
 void ObjectIndexList::rotate(FloorType *floor_ptr)
@@ -28,8 +28,7 @@ void ObjectIndexList::rotate(FloorType *floor_ptr)
         return;
     }
 
-    o_idx_list_.push_back(o_idx_list_.front());
-    o_idx_list_.pop_front();
+    std::rotate(o_idx_list_.begin(), o_idx_list_.begin() + 1, o_idx_list_.end());
 
     for (const auto o_idx : o_idx_list_) {
         floor_ptr->o_list[o_idx].stack_idx++;
@@ -2,7 +2,7 @@
 
 #include "system/angband.h"
 
-#include <list>
+#include <vector>
 
 class FloorType;
 
@@ -10,6 +10,8 @@ class FloorType;
  * @brief アイテムリスト(床上スタック/モンスター所持)を管理するクラス
  *
  * @details ItemEntity 自体を保持するのではなく、フロア全体の ItemEntity 配列上のアイテムの要素番号を保持する
+ * 1マスに積まれるアイテムは高々数個なので、走査が連続したメモリ上で済む std::vector で保持する。
+ * 要素の追加・削除でイテレータが無効になるため、走査しながらアイテムを削除する場合はリストを複製してから走査すること。
  */
 class ObjectIndexList {
 public:
@@ -52,7 +54,7 @@ public:
     void rotate(FloorType *floor_ptr);
 
     //
-    // 以下のメソッドは内部で保持している std::list オブジェクトに対して使用できる同名のメソッド
+    // 以下のメソッドは内部で保持しているコンテナに対して使用できる同名のメソッド
     //
     auto empty() const noexcept
     {
@@ -72,7 +74,7 @@ public:
     }
     void pop_front() noexcept
     {
-        return o_idx_list_.pop_front();
+        o_idx_list_.erase(o_idx_list_.begin());
     }
     auto begin() noexcept
     {
@@ -92,5 +94,5 @@ public:
     }
 
 private:
-    std::list<OBJECT_IDX> o_idx_list_;
+    std::vector<OBJECT_IDX> o_idx_list_;
 };
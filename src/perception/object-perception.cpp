@@ -3,6 +3,7 @@
 #include "flavor/object-flavor-types.h"
 #include "game-option/play-record-options.h"
 #include "io/write-diary.h"
+#include "system/floor-type-definition.h"
 #include "system/item-entity.h"
 #include "system/player-type-definition.h"
 
@@ -17,6 +18,15 @@ void object_aware(PlayerType *player_ptr, const ItemEntity *o_ptr)
     const bool is_already_awared = o_ptr->is_aware();
     auto &baseitem = o_ptr->get_baseitem();
     baseitem.aware = true;
+    if (!is_already_awared) {
+        // 種類が判明すると鑑定済になる床上のアイテムがあるため、同じ種類のアイテムの雰囲気への寄与を求め直させる
+        auto &floor = *player_ptr->current_floor_ptr;
+        for (OBJECT_IDX i = 1; i < floor.o_max; i++) {
+            if (floor.o_list[i].bi_id == o_ptr->bi_id) {
+                floor.invalidate_item_feeling(i);
+            }
+        }
+    }
 
     // 以下、playrecordに記録しない場合はreturnする
     if (!record_ident) {
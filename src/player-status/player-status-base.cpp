@@ -1,5 +1,6 @@
 #include "player-status/player-status-base.h"
 #include "inventory/inventory-slot-types.h"
+#include "player/player-status-flags.h"
 #include "player/player-status.h"
 #include "system/item-entity.h"
 #include "system/player-type-definition.h"
@@ -216,7 +217,7 @@ BIT_FLAGS PlayerStatusBase::equipments_flags(tr_type check_flag)
             continue;
         }
 
-        const auto o_flags = o_ptr->get_flags();
+        const auto o_flags = get_equipment_flags(this->player_ptr, i);
         if (o_flags.has(check_flag)) {
             set_bits(flags, convert_inventory_slot_type_to_flag_cause(i2enum<inventory_slot_type>(i)));
         }
@@ -239,7 +240,7 @@ BIT_FLAGS PlayerStatusBase::equipments_bad_flags(tr_type check_flag)
             continue;
         }
 
-        const auto o_flags = o_ptr->get_flags();
+        const auto o_flags = get_equipment_flags(this->player_ptr, i);
         if (o_flags.has(check_flag)) {
             if (o_ptr->pval < 0) {
                 set_bits(flags, convert_inventory_slot_type_to_flag_cause(i2enum<inventory_slot_type>(i)));
@@ -260,7 +261,7 @@ int16_t PlayerStatusBase::equipments_bonus()
     int16_t bonus = 0;
     for (int i = INVEN_MAIN_HAND; i < INVEN_TOTAL; i++) {
         const auto *o_ptr = &player_ptr->inventory_list[i];
-        const auto o_flags = o_ptr->get_flags();
+        const auto o_flags = get_equipment_flags(this->player_ptr, i);
         if (!o_ptr->is_valid()) {
             continue;
         }
@@ -114,6 +114,56 @@ BIT_FLAGS convert_inventory_slot_type_to_flag_cause(inventory_slot_type inventor
     }
 }
 
+/*!
+ * @brief 装備スロット毎の特性フラグを求め、以降の get_equipment_flags() で使われるようにする
+ * @param player_ptr プレイヤーへの参照ポインタ
+ */
+EquipmentFlagsCache::EquipmentFlagsCache(PlayerType *player_ptr)
+    : previous(active)
+    , player_ptr(player_ptr)
+{
+    for (int i = INVEN_MAIN_HAND; i < INVEN_TOTAL; i++) {
+        this->flags[i - INVEN_MAIN_HAND] = player_ptr->inventory_list[i].get_flags();
+    }
+
+    active = this;
+}
+
+EquipmentFlagsCache::~EquipmentFlagsCache()
+{
+    active = this->previous;
+}
+
+/*!
+ * @brief 指定したプレイヤーの装備品について有効なキャッシュを探す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @return 有効なキャッシュがあればそのポインタ、なければnullptr
+ */
+const EquipmentFlagsCache *EquipmentFlagsCache::find(const PlayerType *player_ptr)
+{
+    return ((active != nullptr) && (active->player_ptr == player_ptr)) ? active : nullptr;
+}
+
+const TrFlags &EquipmentFlagsCache::get_flags(int slot) const
+{
+    return this->flags[slot - INVEN_MAIN_HAND];
+}
+
+/*!
+ * @brief 装備スロットにあるアイテムの特性フラグを返す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param slot 装備スロット (INVEN_MAIN_HAND 以上 INVEN_TOTAL 未満)
+ * @return 特性フラグ (EquipmentFlagsCache が有効ならばその計算結果)
+ */
+TrFlags get_equipment_flags(PlayerType *player_ptr, int slot)
+{
+    if (const auto *cache = EquipmentFlagsCache::find(player_ptr); cache != nullptr) {
+        return cache->get_flags(slot);
+    }
+
+    return player_ptr->inventory_list[slot].get_flags();
+}
+
 /*!
  * @brief 装備による所定の特性フラグを得ているかを一括して取得する関数。
  */
@@ -127,7 +177,7 @@ BIT_FLAGS check_equipment_flags(PlayerType *player_ptr, tr_type tr_flag)
             continue;
         }
 
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
 
         if (flags.has(tr_flag)) {
             set_bits(result, convert_inventory_slot_type_to_flag_cause(i2enum<inventory_slot_type>(i)));
@@ -795,7 +845,7 @@ BIT_FLAGS has_warning(PlayerType *player_ptr)
             continue;
         }
 
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
 
         if (flags.has(TR_WARNING)) {
             if (!o_ptr->is_inscribed() || !angband_strchr(o_ptr->inscription->data(), '$')) {
@@ -1061,7 +1111,7 @@ void update_curses(PlayerType *player_ptr)
         if (!o_ptr->is_valid()) {
             continue;
         }
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
         if (flags.has(TR_AGGRAVATE)) {
             player_ptr->cursed.set(CurseTraitType::AGGRAVATE);
         }
@@ -1172,7 +1222,7 @@ void update_extra_blows(PlayerType *player_ptr)
             continue;
         }
 
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
         if (flags.has(TR_BLOWS)) {
             if ((i == INVEN_MAIN_HAND || i == INVEN_MAIN_RING) && !two_handed) {
                 player_ptr->extra_blows[0] += o_ptr->pval;
@@ -1475,7 +1525,7 @@ BIT_FLAGS has_vuln_curse(PlayerType *player_ptr)
             continue;
         }
 
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
 
         if (flags.has(TR_VUL_CURSE) || o_ptr->curse_flags.has(CurseTraitType::VUL_CURSE)) {
             set_bits(result, convert_inventory_slot_type_to_flag_cause(i2enum<inventory_slot_type>(i)));
@@ -1500,7 +1550,7 @@ BIT_FLAGS has_heavy_vuln_curse(PlayerType *player_ptr)
             continue;
         }
 
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
 
         if ((flags.has(TR_VUL_CURSE) || o_ptr->curse_flags.has(CurseTraitType::VUL_CURSE)) && o_ptr->curse_flags.has(CurseTraitType::HEAVY_CURSE)) {
             set_bits(result, convert_inventory_slot_type_to_flag_cause(i2enum<inventory_slot_type>(i)));
@@ -1717,7 +1767,7 @@ bool has_disable_two_handed_bonus(PlayerType *player_ptr, int i)
 bool is_wielding_icky_weapon(PlayerType *player_ptr, int i)
 {
     const auto *o_ptr = &player_ptr->inventory_list[INVEN_MAIN_HAND + i];
-    const auto flags = o_ptr->get_flags();
+    const auto flags = get_equipment_flags(player_ptr, INVEN_MAIN_HAND + i);
 
     const auto tval = o_ptr->bi_key.tval();
     const auto has_no_weapon = (tval == ItemKindType::NONE) || (tval == ItemKindType::SHIELD);
@@ -1745,7 +1795,7 @@ bool is_wielding_icky_weapon(PlayerType *player_ptr, int i)
 bool is_wielding_icky_riding_weapon(PlayerType *player_ptr, int i)
 {
     const auto *o_ptr = &player_ptr->inventory_list[INVEN_MAIN_HAND + i];
-    const auto flags = o_ptr->get_flags();
+    const auto flags = get_equipment_flags(player_ptr, INVEN_MAIN_HAND + i);
     const auto tval = o_ptr->bi_key.tval();
     const auto has_no_weapon = (tval == ItemKindType::NONE) || (tval == ItemKindType::SHIELD);
     const auto is_suitable = o_ptr->is_lance() || flags.has(TR_RIDING);
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "inventory/inventory-slot-types.h"
+#include "object-enchant/tr-flags.h"
 #include "object-enchant/tr-types.h"
 #include "system/angband.h"
+#include <array>
 
 enum flag_cause : uint32_t {
     FLAG_CAUSE_NONE = 0x0U,
@@ -48,6 +50,32 @@ enum aggravate_state {
 };
 
 class PlayerType;
+
+/*!
+ * @brief 装備品の特性フラグの計算結果を一時的に保持する
+ * @details ItemEntity::get_flags() はベースアイテム・アーティファクト・エゴ・鍛冶の効果を毎回合成する.
+ * update_bonuses() は数十の has_*() / calc_*() から同じ装備品のフラグを繰り返し求めるので、
+ * このオブジェクトの生存期間中は装備スロット毎に1度だけ求めた結果を get_equipment_flags() が返す.
+ * 生存期間中に装備品を変更してはならない.
+ */
+class EquipmentFlagsCache {
+public:
+    EquipmentFlagsCache(PlayerType *player_ptr);
+    ~EquipmentFlagsCache();
+    EquipmentFlagsCache(const EquipmentFlagsCache &) = delete;
+    EquipmentFlagsCache &operator=(const EquipmentFlagsCache &) = delete;
+
+    static const EquipmentFlagsCache *find(const PlayerType *player_ptr);
+    const TrFlags &get_flags(int slot) const;
+
+private:
+    static inline EquipmentFlagsCache *active = nullptr;
+    EquipmentFlagsCache *previous;
+    const PlayerType *player_ptr;
+    std::array<TrFlags, INVEN_TOTAL - INVEN_MAIN_HAND> flags{};
+};
+
+TrFlags get_equipment_flags(PlayerType *player_ptr, int slot);
 BIT_FLAGS convert_inventory_slot_type_to_flag_cause(inventory_slot_type inventory_slot);
 BIT_FLAGS check_equipment_flags(PlayerType *player_ptr, tr_type tr_flag);
 BIT_FLAGS get_player_flags(PlayerType *player_ptr, tr_type tr_flag);
@@ -257,6 +257,7 @@ static void update_ability_scores(PlayerType *player_ptr)
  */
 static void update_bonuses(PlayerType *player_ptr)
 {
+    const EquipmentFlagsCache equipment_flags_cache(player_ptr);
     auto empty_hands_status = empty_hands(player_ptr, true);
     ItemEntity *o_ptr;
 
@@ -1059,7 +1060,7 @@ short calc_num_fire(PlayerType *player_ptr, const ItemEntity *o_ptr)
             continue;
         }
 
-        if (q_ptr->get_flags().has(TR_XTRA_SHOTS)) {
+        if (get_equipment_flags(player_ptr, i).has(TR_XTRA_SHOTS)) {
             extra_shots++;
         }
     }
@@ -1175,7 +1176,7 @@ static ACTION_SKILL_POWER calc_device_ability(PlayerType *player_ptr)
             continue;
         }
 
-        if (o_ptr->get_flags().has(TR_MAGIC_MASTERY)) {
+        if (get_equipment_flags(player_ptr, i).has(TR_MAGIC_MASTERY)) {
             pow += 8 * o_ptr->pval;
         }
     }
@@ -1304,7 +1305,7 @@ static ACTION_SKILL_POWER calc_search(PlayerType *player_ptr)
             continue;
         }
 
-        if (o_ptr->get_flags().has(TR_SEARCH)) {
+        if (get_equipment_flags(player_ptr, i).has(TR_SEARCH)) {
             pow += (o_ptr->pval * 5);
         }
     }
@@ -1355,7 +1356,7 @@ static ACTION_SKILL_POWER calc_search_freq(PlayerType *player_ptr)
             continue;
         }
 
-        if (o_ptr->get_flags().has(TR_SEARCH)) {
+        if (get_equipment_flags(player_ptr, i).has(TR_SEARCH)) {
             pow += (o_ptr->pval * 5);
         }
     }
@@ -1493,7 +1494,7 @@ static ACTION_SKILL_POWER calc_skill_dig(PlayerType *player_ptr)
             continue;
         }
 
-        if (o_ptr->get_flags().has(TR_TUNNEL)) {
+        if (get_equipment_flags(player_ptr, i).has(TR_TUNNEL)) {
             pow += (o_ptr->pval * 20);
         }
     }
@@ -1782,7 +1783,7 @@ static ARMOUR_CLASS calc_to_ac(PlayerType *player_ptr, bool is_real_value)
 
     for (int i = INVEN_MAIN_HAND; i < INVEN_TOTAL; i++) {
         const auto *o_ptr = &player_ptr->inventory_list[i];
-        const auto flags = o_ptr->get_flags();
+        const auto flags = get_equipment_flags(player_ptr, i);
         if (!o_ptr->is_valid()) {
             continue;
         }
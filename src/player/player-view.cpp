@@ -4,12 +4,48 @@
 #include "game-option/map-screen-options.h"
 #include "grid/grid.h"
 #include "system/floor-type-definition.h"
+#include "system/gamevalue.h"
 #include "system/grid-type-definition.h"
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
+#include "system/turn-profiler.h"
 #include "util/point-2d.h"
+#include <algorithm>
+#include <array>
 #include <vector>
 
+namespace {
+/*!
+ * @brief 視界の八角形の形状テンプレート
+ * @details 視界の形状は視界距離 (full) と斜め方向の上限 (over) のみから決まるため、
+ * 短冊 (strip) 毎の最大長を事前に計算しておく.
+ */
+struct ViewTemplate {
+    int full;
+    int over;
+    int diagonal; //!< 斜め方向に視線が通る最大距離
+    std::array<int, MAX_PLAYER_SIGHT * 3 / 4 + 1> strip_lengths; //!< n番目の短冊の最大長 (添字0は未使用)
+};
+
+constexpr ViewTemplate make_view_template(int full, int over)
+{
+    ViewTemplate view_template{ full, over, full * 2 / 3, {} };
+    for (auto n = 1; n <= over / 2; n++) {
+        auto z = std::min(over - n - n, full - n);
+        while ((z + n + (n >> 1)) > full) {
+            z--;
+        }
+
+        view_template.strip_lengths[n] = z;
+    }
+
+    return view_template;
+}
+
+constexpr auto VIEW_TEMPLATE_NORMAL = make_view_template(MAX_PLAYER_SIGHT, MAX_PLAYER_SIGHT * 3 / 2);
+constexpr auto VIEW_TEMPLATE_REDUCED = make_view_template(MAX_PLAYER_SIGHT / 2, MAX_PLAYER_SIGHT * 3 / 4);
+}
+
 /*
  * Helper function for "update_view()" below
  *
@@ -100,29 +136,24 @@ static bool update_view_aux(PlayerType *player_ptr, POSITION y, POSITION x, POSI
  */
 void update_view(PlayerType *player_ptr)
 {
-    // 前回プレイヤーから見えていた座標たちを格納する配列。
-    std::vector<Pos2D> points;
+    TurnProfileScope profile_scope(TurnPhase::UPDATE_VIEW);
+    // 前回プレイヤーから見えていた座標たちを格納する配列。毎回の再確保を避けるため使い回す.
+    static std::vector<Pos2D> points;
+    points.clear();
 
     int n, m, d, k, z;
     POSITION y, x;
 
     int se, sw, ne, nw, es, en, ws, wn;
 
-    int full, over;
-
     auto *floor_ptr = player_ptr->current_floor_ptr;
     POSITION y_max = floor_ptr->height - 1;
     POSITION x_max = floor_ptr->width - 1;
 
     Grid *g_ptr;
-    if (view_reduce_view && !floor_ptr->dun_level) {
-        full = MAX_PLAYER_SIGHT / 2;
-        over = MAX_PLAYER_SIGHT * 3 / 4;
-    } else {
-        full = MAX_PLAYER_SIGHT;
-        over = MAX_PLAYER_SIGHT * 3 / 2;
-    }
-
+    const auto &view_template = (view_reduce_view && !floor_ptr->dun_level) ? VIEW_TEMPLATE_REDUCED : VIEW_TEMPLATE_NORMAL;
+    const auto full = view_template.full;
+    const auto over = view_template.over;
     for (n = 0; n < floor_ptr->view_n; n++) {
         y = floor_ptr->view_y[n];
         x = floor_ptr->view_x[n];
@@ -140,7 +171,7 @@ void update_view(PlayerType *player_ptr)
     g_ptr->info |= CAVE_XTRA;
     cave_view_hack(floor_ptr, y, x);
 
-    z = full * 2 / 3;
+    z = view_template.diagonal;
     for (d = 1; d <= z; d++) {
         g_ptr = &floor_ptr->grid_array[y + d][x + d];
         g_ptr->info |= CAVE_XTRA;
@@ -219,15 +250,7 @@ void update_view(PlayerType *player_ptr)
     ws = wn = d;
     for (n = 1; n <= over / 2; n++) {
         POSITION ypn, ymn, xpn, xmn;
-        z = over - n - n;
-        if (z > full - n) {
-            z = full - n;
-        }
-
-        while ((z + n + (n >> 1)) > full) {
-            z--;
-        }
-
+        z = view_template.strip_lengths[n];
         ypn = y + n;
         ymn = y - n;
         xpn = x + n;
@@ -36,13 +36,39 @@
 #include "system/grid-type-definition.h"
 #include "system/player-type-definition.h"
 #include "util/probability-table.h"
+#include "util/string-processor.h"
 #include "wizard/wizard-messages.h"
+#include <algorithm>
+#include <array>
 
 /*
  * The vault generation arrays
  */
 std::vector<vault_type> vaults_info;
 
+/*!
+ * @brief Vaultの文字列を、配置するマスの一覧に変換する
+ * @details 配置の度に空白を含む文字列全体を走査せずに済むよう、読み込み時に1度だけ行う.
+ */
+void vault_type::compile_tiles()
+{
+    this->tiles.clear();
+    this->inhabitant_tiles.clear();
+    const auto size = std::min<size_t>(this->text.size(), this->hgt * this->wid);
+    for (size_t i = 0; i < size; i++) {
+        const auto symbol = this->text[i];
+        if (symbol == ' ') {
+            continue;
+        }
+
+        const VaultTile tile{ static_cast<uint8_t>(i / this->wid), static_cast<uint8_t>(i % this->wid), symbol };
+        this->tiles.push_back(tile);
+        if (angband_strchr("&@98,", symbol) != nullptr) {
+            this->inhabitant_tiles.push_back(tile);
+        }
+    }
+}
+
 /*
  * This function creates a random vault that looks like a collection of bubbles.
  * It works by getting a set of coordinates that represent the center of each
@@ -271,7 +297,7 @@ static void build_cave_vault(PlayerType *player_ptr, POSITION x0, POSITION y0, P
  * @param yoffset Vault生成時の基準Y座標
  * @param transno 処理ID
  */
-static void coord_trans(POSITION *x, POSITION *y, POSITION xoffset, POSITION yoffset, int transno)
+static constexpr void coord_trans(POSITION *x, POSITION *y, POSITION xoffset, POSITION yoffset, int transno)
 {
     int i;
     int temp;
@@ -302,304 +328,294 @@ static void coord_trans(POSITION *x, POSITION *y, POSITION xoffset, POSITION yof
     *y += yoffset;
 }
 
+/*!
+ * @brief Vaultの回転・反転を表す変換行列
+ * @details (x, y) は (xx * x + xy * y, yx * x + yy * y) に移る.
+ */
+struct VaultTransform {
+    int xx;
+    int xy;
+    int yx;
+    int yy;
+};
+
+/*!
+ * @brief 8通りの回転・反転について、coord_trans() と同じ変換行列を求める
+ */
+static constexpr std::array<VaultTransform, 8> make_vault_transforms()
+{
+    std::array<VaultTransform, 8> transforms{};
+    for (auto transno = 0; transno < 8; transno++) {
+        POSITION x1 = 1;
+        POSITION y1 = 0;
+        coord_trans(&x1, &y1, 0, 0, transno);
+        POSITION x2 = 0;
+        POSITION y2 = 1;
+        coord_trans(&x2, &y2, 0, 0, transno);
+        transforms[transno] = { x1, x2, y1, y2 };
+    }
+
+    return transforms;
+}
+
+static constexpr auto VAULT_TRANSFORMS = make_vault_transforms();
+
 /*!
  * @brief Vaultをフロアに配置する / Hack -- fill in "vault" rooms
  * @param player_ptr プレイヤーへの参照ポインタ
  * @param yval 生成基準Y座標
  * @param xval 生成基準X座標
- * @param ymax VaultのYサイズ
- * @param xmax VaultのXサイズ
- * @param data Vaultのデータ文字列
+ * @param vault 配置するVault
  * @param xoffset 変換基準X座標
  * @param yoffset 変換基準Y座標
  * @param transno 変換ID
  */
-static void build_vault(
-    PlayerType *player_ptr, POSITION yval, POSITION xval, POSITION ymax, POSITION xmax, concptr data, POSITION xoffset, POSITION yoffset, int transno)
+static void build_vault(PlayerType *player_ptr, POSITION yval, POSITION xval, const vault_type &vault, POSITION xoffset, POSITION yoffset, int transno)
 {
-    POSITION dx, dy, x, y, i, j;
-    concptr t;
-    Grid *g_ptr;
+    /* Flip / rotate */
+    const auto &transform = VAULT_TRANSFORMS[transno];
+    const auto is_swapped = (transno % 2) != 0;
+    const auto x0 = xval - ((is_swapped ? vault.hgt : vault.wid) / 2) + xoffset;
+    const auto y0 = yval - ((is_swapped ? vault.wid : vault.hgt) / 2) + yoffset;
+    const auto to_floor_pos = [&transform, x0, y0](const VaultTile &tile) {
+        return Pos2D(y0 + transform.yx * tile.x + transform.yy * tile.y, x0 + transform.xx * tile.x + transform.xy * tile.y);
+    };
 
     /* Place dungeon features and objects */
     auto *floor_ptr = player_ptr->current_floor_ptr;
-    for (t = data, dy = 0; dy < ymax; dy++) {
-        for (dx = 0; dx < xmax; dx++, t++) {
-            /* prevent loop counter from being overwritten */
-            i = dx;
-            j = dy;
-
-            /* Flip / rotate */
-            coord_trans(&i, &j, xoffset, yoffset, transno);
-
-            if (transno % 2 == 0) {
-                /* no swap of x/y */
-                x = xval - (xmax / 2) + i;
-                y = yval - (ymax / 2) + j;
+    for (const auto &tile : vault.tiles) {
+        const auto [y, x] = to_floor_pos(tile);
+        auto *g_ptr = &floor_ptr->grid_array[y][x];
+
+        /* Lay down a floor */
+        place_grid(player_ptr, g_ptr, GB_FLOOR);
+
+        /* Remove any mimic */
+        g_ptr->mimic = 0;
+
+        /* Part of a vault */
+        g_ptr->info |= (CAVE_ROOM | CAVE_ICKY);
+
+        /* Analyze the grid */
+        switch (tile.symbol) {
+            /* Granite wall (outer) */
+        case '%':
+            place_grid(player_ptr, g_ptr, GB_OUTER_NOPERM);
+            break;
+
+            /* Granite wall (inner) */
+        case '#':
+            place_grid(player_ptr, g_ptr, GB_INNER);
+            break;
+
+            /* Glass wall (inner) */
+        case '$':
+            place_grid(player_ptr, g_ptr, GB_INNER);
+            g_ptr->feat = feat_glass_wall;
+            break;
+
+            /* Permanent wall (inner) */
+        case 'X':
+            place_grid(player_ptr, g_ptr, GB_INNER_PERM);
+            break;
+
+            /* Permanent glass wall (inner) */
+        case 'Y':
+            place_grid(player_ptr, g_ptr, GB_INNER_PERM);
+            g_ptr->feat = feat_permanent_glass_wall;
+            break;
+
+            /* Treasure/trap */
+        case '*':
+            if (randint0(100) < 75) {
+                place_object(player_ptr, y, x, 0L);
             } else {
-                /* swap of x/y */
-                x = xval - (ymax / 2) + i;
-                y = yval - (xmax / 2) + j;
+                place_trap(floor_ptr, y, x);
             }
+            break;
 
-            /* Hack -- skip "non-grids" */
-            if (*t == ' ') {
-                continue;
+            /* Treasure */
+        case '[':
+            place_object(player_ptr, y, x, 0L);
+            break;
+
+            /* Tree */
+        case ':':
+            g_ptr->feat = feat_tree;
+            break;
+
+            /* Secret doors */
+        case '+':
+            place_secret_door(player_ptr, y, x, DOOR_DEFAULT);
+            break;
+
+            /* Secret glass doors */
+        case '-':
+            place_secret_door(player_ptr, y, x, DOOR_GLASS_DOOR);
+            if (is_closed_door(player_ptr, g_ptr->feat)) {
+                g_ptr->mimic = feat_glass_wall;
             }
-            g_ptr = &floor_ptr->grid_array[y][x];
+            break;
 
-            /* Lay down a floor */
-            place_grid(player_ptr, g_ptr, GB_FLOOR);
+            /* Curtains */
+        case '\'':
+            place_secret_door(player_ptr, y, x, DOOR_CURTAIN);
+            break;
 
-            /* Remove any mimic */
-            g_ptr->mimic = 0;
+            /* Trap */
+        case '^':
+            place_trap(floor_ptr, y, x);
+            break;
 
-            /* Part of a vault */
-            g_ptr->info |= (CAVE_ROOM | CAVE_ICKY);
+            /* Black market in a dungeon */
+        case 'S':
+            set_cave_feat(floor_ptr, y, x, feat_black_market);
+            store_init(VALID_TOWNS, StoreSaleType::BLACK);
+            break;
 
-            /* Analyze the grid */
-            switch (*t) {
-                /* Granite wall (outer) */
-            case '%':
-                place_grid(player_ptr, g_ptr, GB_OUTER_NOPERM);
-                break;
-
-                /* Granite wall (inner) */
-            case '#':
-                place_grid(player_ptr, g_ptr, GB_INNER);
-                break;
-
-                /* Glass wall (inner) */
-            case '$':
-                place_grid(player_ptr, g_ptr, GB_INNER);
-                g_ptr->feat = feat_glass_wall;
-                break;
-
-                /* Permanent wall (inner) */
-            case 'X':
-                place_grid(player_ptr, g_ptr, GB_INNER_PERM);
-                break;
-
-                /* Permanent glass wall (inner) */
-            case 'Y':
-                place_grid(player_ptr, g_ptr, GB_INNER_PERM);
-                g_ptr->feat = feat_permanent_glass_wall;
-                break;
-
-                /* Treasure/trap */
-            case '*':
-                if (randint0(100) < 75) {
-                    place_object(player_ptr, y, x, 0L);
-                } else {
-                    place_trap(floor_ptr, y, x);
-                }
-                break;
+            /* The Pattern */
+        case 'p':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_start);
+            break;
 
-                /* Treasure */
-            case '[':
-                place_object(player_ptr, y, x, 0L);
-                break;
-
-                /* Tree */
-            case ':':
-                g_ptr->feat = feat_tree;
-                break;
-
-                /* Secret doors */
-            case '+':
-                place_secret_door(player_ptr, y, x, DOOR_DEFAULT);
-                break;
-
-                /* Secret glass doors */
-            case '-':
-                place_secret_door(player_ptr, y, x, DOOR_GLASS_DOOR);
-                if (is_closed_door(player_ptr, g_ptr->feat)) {
-                    g_ptr->mimic = feat_glass_wall;
-                }
-                break;
+        case 'a':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_1);
+            break;
 
-                /* Curtains */
-            case '\'':
-                place_secret_door(player_ptr, y, x, DOOR_CURTAIN);
-                break;
+        case 'b':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_2);
+            break;
 
-                /* Trap */
-            case '^':
-                place_trap(floor_ptr, y, x);
-                break;
-
-                /* Black market in a dungeon */
-            case 'S':
-                set_cave_feat(floor_ptr, y, x, feat_black_market);
-                store_init(VALID_TOWNS, StoreSaleType::BLACK);
-                break;
-
-                /* The Pattern */
-            case 'p':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_start);
-                break;
-
-            case 'a':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_1);
-                break;
-
-            case 'b':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_2);
-                break;
-
-            case 'c':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_3);
-                break;
-
-            case 'd':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_4);
-                break;
-
-            case 'P':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_end);
-                break;
-
-            case 'B':
-                set_cave_feat(floor_ptr, y, x, feat_pattern_exit);
-                break;
-
-            case 'A':
-                /* Reward for Pattern walk */
-                floor_ptr->object_level = floor_ptr->base_level + 12;
-                place_object(player_ptr, y, x, AM_GOOD | AM_GREAT);
-                floor_ptr->object_level = floor_ptr->base_level;
-                break;
+        case 'c':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_3);
+            break;
 
-            case '~':
-                set_cave_feat(floor_ptr, y, x, feat_shallow_water);
-                break;
+        case 'd':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_4);
+            break;
 
-            case '=':
-                set_cave_feat(floor_ptr, y, x, feat_deep_water);
-                break;
+        case 'P':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_end);
+            break;
 
-            case 'v':
-                set_cave_feat(floor_ptr, y, x, feat_shallow_lava);
-                break;
+        case 'B':
+            set_cave_feat(floor_ptr, y, x, feat_pattern_exit);
+            break;
 
-            case 'w':
-                set_cave_feat(floor_ptr, y, x, feat_deep_lava);
-                break;
+        case 'A':
+            /* Reward for Pattern walk */
+            floor_ptr->object_level = floor_ptr->base_level + 12;
+            place_object(player_ptr, y, x, AM_GOOD | AM_GREAT);
+            floor_ptr->object_level = floor_ptr->base_level;
+            break;
 
-            case 'f':
-                set_cave_feat(floor_ptr, y, x, feat_shallow_acid_puddle);
-                break;
+        case '~':
+            set_cave_feat(floor_ptr, y, x, feat_shallow_water);
+            break;
 
-            case 'F':
-                set_cave_feat(floor_ptr, y, x, feat_deep_acid_puddle);
-                break;
+        case '=':
+            set_cave_feat(floor_ptr, y, x, feat_deep_water);
+            break;
 
-            case 'g':
-                set_cave_feat(floor_ptr, y, x, feat_shallow_poisonous_puddle);
-                break;
+        case 'v':
+            set_cave_feat(floor_ptr, y, x, feat_shallow_lava);
+            break;
 
-            case 'G':
-                set_cave_feat(floor_ptr, y, x, feat_deep_poisonous_puddle);
-                break;
+        case 'w':
+            set_cave_feat(floor_ptr, y, x, feat_deep_lava);
+            break;
 
-            case 'h':
-                set_cave_feat(floor_ptr, y, x, feat_cold_zone);
-                break;
+        case 'f':
+            set_cave_feat(floor_ptr, y, x, feat_shallow_acid_puddle);
+            break;
 
-            case 'H':
-                set_cave_feat(floor_ptr, y, x, feat_heavy_cold_zone);
-                break;
+        case 'F':
+            set_cave_feat(floor_ptr, y, x, feat_deep_acid_puddle);
+            break;
 
-            case 'i':
-                set_cave_feat(floor_ptr, y, x, feat_electrical_zone);
-                break;
+        case 'g':
+            set_cave_feat(floor_ptr, y, x, feat_shallow_poisonous_puddle);
+            break;
 
-            case 'I':
-                set_cave_feat(floor_ptr, y, x, feat_heavy_electrical_zone);
-                break;
-            }
+        case 'G':
+            set_cave_feat(floor_ptr, y, x, feat_deep_poisonous_puddle);
+            break;
+
+        case 'h':
+            set_cave_feat(floor_ptr, y, x, feat_cold_zone);
+            break;
+
+        case 'H':
+            set_cave_feat(floor_ptr, y, x, feat_heavy_cold_zone);
+            break;
+
+        case 'i':
+            set_cave_feat(floor_ptr, y, x, feat_electrical_zone);
+            break;
+
+        case 'I':
+            set_cave_feat(floor_ptr, y, x, feat_heavy_electrical_zone);
+            break;
         }
     }
 
     /* Place dungeon monsters and objects */
-    for (t = data, dy = 0; dy < ymax; dy++) {
-        for (dx = 0; dx < xmax; dx++, t++) {
-            /* prevent loop counter from being overwritten */
-            i = dx;
-            j = dy;
-
-            /* Flip / rotate */
-            coord_trans(&i, &j, xoffset, yoffset, transno);
-
-            if (transno % 2 == 0) {
-                /* no swap of x/y */
-                x = xval - (xmax / 2) + i;
-                y = yval - (ymax / 2) + j;
-            } else {
-                /* swap of x/y */
-                x = xval - (ymax / 2) + i;
-                y = yval - (xmax / 2) + j;
-            }
+    for (const auto &tile : vault.inhabitant_tiles) {
+        const auto [y, x] = to_floor_pos(tile);
+
+        /* Analyze the symbol */
+        switch (tile.symbol) {
+        case '&': {
+            floor_ptr->monster_level = floor_ptr->base_level + 5;
+            place_random_monster(player_ptr, y, x, (PM_ALLOW_SLEEP | PM_ALLOW_GROUP));
+            floor_ptr->monster_level = floor_ptr->base_level;
+            break;
+        }
 
-            /* Hack -- skip "non-grids" */
-            if (*t == ' ') {
-                continue;
-            }
+        /* Meaner monster */
+        case '@': {
+            floor_ptr->monster_level = floor_ptr->base_level + 11;
+            place_random_monster(player_ptr, y, x, (PM_ALLOW_SLEEP | PM_ALLOW_GROUP));
+            floor_ptr->monster_level = floor_ptr->base_level;
+            break;
+        }
 
-            /* Analyze the symbol */
-            switch (*t) {
-            case '&': {
-                floor_ptr->monster_level = floor_ptr->base_level + 5;
-                place_random_monster(player_ptr, y, x, (PM_ALLOW_SLEEP | PM_ALLOW_GROUP));
-                floor_ptr->monster_level = floor_ptr->base_level;
-                break;
-            }
+        /* Meaner monster, plus treasure */
+        case '9': {
+            floor_ptr->monster_level = floor_ptr->base_level + 9;
+            place_random_monster(player_ptr, y, x, PM_ALLOW_SLEEP);
+            floor_ptr->monster_level = floor_ptr->base_level;
+            floor_ptr->object_level = floor_ptr->base_level + 7;
+            place_object(player_ptr, y, x, AM_GOOD);
+            floor_ptr->object_level = floor_ptr->base_level;
+            break;
+        }
 
-            /* Meaner monster */
-            case '@': {
-                floor_ptr->monster_level = floor_ptr->base_level + 11;
+        /* Nasty monster and treasure */
+        case '8': {
+            floor_ptr->monster_level = floor_ptr->base_level + 40;
+            place_random_monster(player_ptr, y, x, PM_ALLOW_SLEEP);
+            floor_ptr->monster_level = floor_ptr->base_level;
+            floor_ptr->object_level = floor_ptr->base_level + 20;
+            place_object(player_ptr, y, x, AM_GOOD | AM_GREAT);
+            floor_ptr->object_level = floor_ptr->base_level;
+            break;
+        }
+
+        /* Monster and/or object */
+        case ',': {
+            if (randint0(100) < 50) {
+                floor_ptr->monster_level = floor_ptr->base_level + 3;
                 place_random_monster(player_ptr, y, x, (PM_ALLOW_SLEEP | PM_ALLOW_GROUP));
                 floor_ptr->monster_level = floor_ptr->base_level;
-                break;
             }
-
-            /* Meaner monster, plus treasure */
-            case '9': {
-                floor_ptr->monster_level = floor_ptr->base_level + 9;
-                place_random_monster(player_ptr, y, x, PM_ALLOW_SLEEP);
-                floor_ptr->monster_level = floor_ptr->base_level;
+            if (randint0(100) < 50) {
                 floor_ptr->object_level = floor_ptr->base_level + 7;
-                place_object(player_ptr, y, x, AM_GOOD);
-                floor_ptr->object_level = floor_ptr->base_level;
-                break;
-            }
-
-            /* Nasty monster and treasure */
-            case '8': {
-                floor_ptr->monster_level = floor_ptr->base_level + 40;
-                place_random_monster(player_ptr, y, x, PM_ALLOW_SLEEP);
-                floor_ptr->monster_level = floor_ptr->base_level;
-                floor_ptr->object_level = floor_ptr->base_level + 20;
-                place_object(player_ptr, y, x, AM_GOOD | AM_GREAT);
+                place_object(player_ptr, y, x, 0L);
                 floor_ptr->object_level = floor_ptr->base_level;
-                break;
-            }
-
-            /* Monster and/or object */
-            case ',': {
-                if (randint0(100) < 50) {
-                    floor_ptr->monster_level = floor_ptr->base_level + 3;
-                    place_random_monster(player_ptr, y, x, (PM_ALLOW_SLEEP | PM_ALLOW_GROUP));
-                    floor_ptr->monster_level = floor_ptr->base_level;
-                }
-                if (randint0(100) < 50) {
-                    floor_ptr->object_level = floor_ptr->base_level + 7;
-                    place_object(player_ptr, y, x, 0L);
-                    floor_ptr->object_level = floor_ptr->base_level;
-                }
-                break;
-            }
             }
+            break;
+        }
         }
     }
 }
@@ -1073,7 +1089,7 @@ bool build_fixed_room(PlayerType *player_ptr, dun_data_type *dd_ptr, int typ, bo
     msg_format_wizard(player_ptr, CHEAT_DUNGEON, _("固定部屋(%s)を生成しました。", "Fixed room (%s)."), v_ptr->name.data());
 
     /* Hack -- Build the vault */
-    build_vault(player_ptr, yval, xval, v_ptr->hgt, v_ptr->wid, v_ptr->text.data(), xoffset, yoffset, transno);
+    build_vault(player_ptr, yval, xval, *v_ptr, xoffset, yoffset, transno);
 
     return true;
 }
@@ -4,6 +4,15 @@
 #include <string>
 #include <vector>
 
+/*!
+ * @brief Vaultの1マス分の配置内容
+ */
+struct VaultTile {
+    uint8_t y; //!< Vault内のY座標
+    uint8_t x; //!< Vault内のX座標
+    char symbol; //!< VaultDefinitions.txt 上の文字
+};
+
 struct vault_type {
     vault_type() = default;
     short idx = 0;
@@ -15,6 +24,11 @@ struct vault_type {
     int rat = 0; /* Vault rating (unused) */
     int hgt = 0; /* Vault height */
     int wid = 0; /* Vault width */
+
+    std::vector<VaultTile> tiles; //!< 空白以外の全マス (text の並び順)
+    std::vector<VaultTile> inhabitant_tiles; //!< モンスターやアイテムを配置するマス (text の並び順)
+
+    void compile_tiles();
 };
 
 extern std::vector<vault_type> vaults_info;
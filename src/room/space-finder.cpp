@@ -7,6 +7,7 @@
 #include "system/floor-type-definition.h"
 #include "system/grid-type-definition.h"
 #include "system/player-type-definition.h"
+#include <vector>
 
 /*!
  * @brief 指定のマスが床系地形であるかを返す
@@ -107,6 +108,16 @@ static void check_room_boundary(PlayerType *player_ptr, const Pos2D &pos1, const
     }
 }
 
+/*!
+ * @brief 1行分のブロックの使用状況のうち、指定範囲の列を表すビットを返す
+ * @param bx1 範囲の左端
+ * @param bx2 範囲の右端 (範囲に含まない)
+ */
+static uint32_t get_block_mask(int bx1, int bx2)
+{
+    return ((1U << (bx2 - bx1)) - 1) << bx1;
+}
+
 /*!
  * @brief find_space()の予備処理として部屋の生成が可能かを判定する
  * @param blocks_high 範囲の高さ
@@ -150,11 +161,10 @@ static bool find_space_aux(dun_data_type *dd_ptr, const Pos2D &max_block_size, c
         return false;
     }
 
+    const auto mask = get_block_mask(bx1, bx2);
     for (auto by = by1; by < by2; by++) {
-        for (auto bx = bx1; bx < bx2; bx++) {
-            if (dd_ptr->room_map[by][bx]) {
-                return false;
-            }
+        if (dd_ptr->room_map[by] & mask) {
+            return false;
         }
     }
 
@@ -193,41 +203,28 @@ bool find_space(PlayerType *player_ptr, dun_data_type *dd_ptr, POSITION *y, POSI
         return false;
     }
 
-    int candidates = 0;
+    std::vector<Pos2D> candidates;
     for (block_y = dd_ptr->row_rooms - blocks_high; block_y >= 0; block_y--) {
         for (block_x = dd_ptr->col_rooms - blocks_wide; block_x >= 0; block_x--) {
             if (find_space_aux(dd_ptr, { blocks_high, blocks_wide }, { block_y, block_x })) {
                 /* Find a valid place */
-                candidates++;
+                candidates.emplace_back(block_y, block_x);
             }
         }
     }
 
-    if (!candidates) {
+    if (candidates.empty()) {
         return false;
     }
 
     if (player_ptr->current_floor_ptr->get_dungeon_definition().flags.has_not(DungeonFeatureType::NO_CAVE)) {
-        pick = randint1(candidates);
+        pick = randint0(candidates.size());
     } else {
-        pick = candidates / 2 + 1;
-    }
-
-    for (block_y = dd_ptr->row_rooms - blocks_high; block_y >= 0; block_y--) {
-        for (block_x = dd_ptr->col_rooms - blocks_wide; block_x >= 0; block_x--) {
-            if (find_space_aux(dd_ptr, { blocks_high, blocks_wide }, { block_y, block_x })) {
-                pick--;
-                if (!pick) {
-                    break;
-                }
-            }
-        }
-
-        if (!pick) {
-            break;
-        }
+        pick = candidates.size() / 2;
     }
 
+    block_y = candidates[pick].y;
+    block_x = candidates[pick].x;
     POSITION by1 = block_y;
     POSITION bx1 = block_x;
     POSITION by2 = block_y + blocks_high;
@@ -240,14 +237,9 @@ bool find_space(PlayerType *player_ptr, dun_data_type *dd_ptr, POSITION *y, POSI
         dd_ptr->cent_n++;
     }
 
+    const auto mask = get_block_mask(bx1, bx2);
     for (POSITION by = by1; by < by2; by++) {
-        for (POSITION bx = bx1; bx < bx2; bx++) {
-            if ((by < 0) || (bx < 0)) {
-                continue;
-            }
-
-            dd_ptr->room_map[by][bx] = true;
-        }
+        dd_ptr->room_map[by] |= mask;
     }
 
     check_room_boundary(player_ptr, { *y - height / 2 - 1, *x - width / 2 - 1 }, { *y + (height - 1) / 2 + 1, *x + (width - 1) / 2 + 1 });
@@ -15,10 +15,36 @@
 #include "system/floor-type-definition.h"
 #include "system/grid-type-definition.h"
 #include "system/item-entity.h"
+#include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "term/z-form.h"
 #include "util/angband-files.h"
-#include "util/sort.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+/*!
+ * @brief 保存フロアのgrid情報テンプレートを同一視するためのキー
+ */
+struct GridTemplateKey {
+    BIT_FLAGS info;
+    FEAT_IDX feat;
+    FEAT_IDX mimic;
+    int16_t special;
+
+    bool operator==(const GridTemplateKey &other) const = default;
+};
+
+struct GridTemplateKeyHash {
+    size_t operator()(const GridTemplateKey &key) const noexcept
+    {
+        const auto terrains = (static_cast<uint64_t>(static_cast<uint16_t>(key.feat)) << 32) | (static_cast<uint64_t>(static_cast<uint16_t>(key.mimic)) << 16) | static_cast<uint16_t>(key.special);
+        return std::hash<uint64_t>()(terrains ^ (static_cast<uint64_t>(key.info) * 0x9E3779B97F4A7C15ULL));
+    }
+};
+}
 
 /*!
  * @brief 保存フロアの書き込み / Actually write a saved floor data using effectively compressed format.
@@ -59,31 +85,36 @@ void wr_saved_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr)
      */
 
     std::vector<grid_template_type> templates;
+    std::unordered_map<GridTemplateKey, uint16_t, GridTemplateKeyHash> template_ids;
+    std::vector<uint16_t> grid_template_ids;
+    grid_template_ids.reserve(floor_ptr->height * floor_ptr->width);
     for (int y = 0; y < floor_ptr->height; y++) {
         for (int x = 0; x < floor_ptr->width; x++) {
-            auto *g_ptr = &floor_ptr->grid_array[y][x];
-            uint i;
-            for (i = 0; i < templates.size(); i++) {
-                if (templates[i].info == g_ptr->info && templates[i].feat == g_ptr->feat && templates[i].mimic == g_ptr->mimic && templates[i].special == g_ptr->special) {
-                    templates[i].occurrence++;
-                    break;
-                }
-            }
-
-            if (i < templates.size()) {
-                continue;
+            const auto &grid = floor_ptr->grid_array[y][x];
+            const GridTemplateKey key{ grid.info, grid.feat, grid.mimic, grid.special };
+            const auto [it, is_new] = template_ids.try_emplace(key, static_cast<uint16_t>(templates.size()));
+            if (is_new) {
+                templates.push_back({ grid.info, grid.feat, grid.mimic, grid.special, 0 });
             }
 
-            templates.push_back({ g_ptr->info, g_ptr->feat, g_ptr->mimic, g_ptr->special, 1 });
+            templates[it->second].occurrence++;
+            grid_template_ids.push_back(it->second);
         }
     }
 
-    int dummy_why;
-    ang_sort(player_ptr, templates.data(), &dummy_why, templates.size(), ang_sort_comp_cave_temp, ang_sort_swap_cave_temp);
+    /* 出現頻度の高い順に並べ替え、初出順のIDから並べ替え後のIDへの対応表を作る */
+    std::vector<uint16_t> order(templates.size());
+    std::iota(order.begin(), order.end(), static_cast<uint16_t>(0));
+    std::stable_sort(order.begin(), order.end(), [&templates](auto a, auto b) { return templates[a].occurrence > templates[b].occurrence; });
+    std::vector<uint16_t> sorted_ids(templates.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        sorted_ids[order[i]] = static_cast<uint16_t>(i);
+    }
 
     /*** Dump templates ***/
     wr_u16b(static_cast<uint16_t>(templates.size()));
-    for (const auto &ct_ref : templates) {
+    for (const auto id : order) {
+        const auto &ct_ref = templates[id];
         wr_u16b(static_cast<uint16_t>(ct_ref.info));
         wr_s16b(ct_ref.feat);
         wr_s16b(ct_ref.mimic);
@@ -92,32 +123,22 @@ void wr_saved_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr)
 
     byte count = 0;
     uint16_t prev_u16b = 0;
-    for (int y = 0; y < floor_ptr->height; y++) {
-        for (int x = 0; x < floor_ptr->width; x++) {
-            auto *g_ptr = &floor_ptr->grid_array[y][x];
-            uint i;
-            for (i = 0; i < templates.size(); i++) {
-                if (templates[i].info == g_ptr->info && templates[i].feat == g_ptr->feat && templates[i].mimic == g_ptr->mimic && templates[i].special == g_ptr->special) {
-                    break;
-                }
-            }
-
-            uint16_t tmp16u = (uint16_t)i;
-            if ((tmp16u == prev_u16b) && (count != MAX_UCHAR)) {
-                count++;
-                continue;
-            }
-
-            wr_byte((byte)count);
-            while (prev_u16b >= MAX_UCHAR) {
-                wr_byte(MAX_UCHAR);
-                prev_u16b -= MAX_UCHAR;
-            }
+    for (const auto id : grid_template_ids) {
+        const auto tmp16u = sorted_ids[id];
+        if ((tmp16u == prev_u16b) && (count != MAX_UCHAR)) {
+            count++;
+            continue;
+        }
 
-            wr_byte((byte)prev_u16b);
-            prev_u16b = tmp16u;
-            count = 1;
+        wr_byte((byte)count);
+        while (prev_u16b >= MAX_UCHAR) {
+            wr_byte(MAX_UCHAR);
+            prev_u16b -= MAX_UCHAR;
         }
+
+        wr_byte((byte)prev_u16b);
+        prev_u16b = tmp16u;
+        count = 1;
     }
 
     if (count > 0) {
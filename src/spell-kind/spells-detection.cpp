@@ -29,6 +29,7 @@
 #include "system/terrain-type-definition.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include <algorithm>
 
 /*!
  * @brief プレイヤー周辺の地形を感知する
@@ -45,9 +46,14 @@ static bool detect_feat_flag(PlayerType *player_ptr, POSITION range, TerrainChar
         range /= 3;
     }
 
+    /* distance() は各軸方向の距離を下回らないので、範囲を囲む矩形の外は調べなくてよい */
+    const auto y_min = std::max<POSITION>(1, player_ptr->y - range);
+    const auto y_max = std::min<POSITION>(floor.height - 2, player_ptr->y + range);
+    const auto x_min = std::max<POSITION>(1, player_ptr->x - range);
+    const auto x_max = std::min<POSITION>(floor.width - 1, player_ptr->x + range);
     bool detect = false;
-    for (POSITION y = 1; y < floor.height - 1; y++) {
-        for (POSITION x = 1; x <= floor.width - 1; x++) {
+    for (auto y = y_min; y <= y_max; y++) {
+        for (auto x = x_min; x <= x_max; x++) {
             int dist = distance(player_ptr->y, player_ptr->x, y, x);
             if (dist > range) {
                 continue;
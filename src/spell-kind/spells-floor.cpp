@@ -54,6 +54,76 @@
 #include "system/terrain-type-definition.h"
 #include "util/bit-flags-calculator.h"
 #include "view/display-messages.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+/*!
+ * @brief 地形IDから、ミミックを適用した地形が記憶対象 (REMEMBER) かを引く表を作る
+ * @return 地形ID毎の記憶対象フラグ
+ * @details フロア全体を走査する前に1度だけ作り、グリッド毎の地形情報の二重参照とフラグ集合の検査を省く.
+ */
+std::vector<bool> make_remember_table()
+{
+    const auto &terrains = TerrainList::get_instance();
+    std::vector<bool> table;
+    table.reserve(terrains.size());
+    for (const auto &terrain : terrains) {
+        table.push_back(terrains[terrain.mimic].flags.has(TerrainCharacteristics::REMEMBER));
+    }
+
+    return table;
+}
+
+/*!
+ * @brief グリッドのミミック適用後の地形が記憶対象かを返す (get_feat_mimic() と同じ規則で地形IDを選ぶ)
+ */
+bool is_remembered(const std::vector<bool> &remember_table, const Grid &grid)
+{
+    return remember_table[grid.mimic ? grid.mimic : grid.feat];
+}
+
+/*!
+ * @brief 啓蒙の地形部分の処理として、フロア全体を明るくし記憶させる
+ * @param floor フロアへの参照
+ * @param ninja 忍者かどうか
+ */
+void lite_whole_floor(FloorType &floor, bool ninja)
+{
+    if ((floor.height < 3) || (floor.width < 3)) {
+        return;
+    }
+
+    /*
+     * 元は内側の各グリッドについて周囲9マスを処理していたが、各処理は冪等なので
+     * 外周を含む全グリッドを1度ずつ処理するのと結果は変わらない.
+     */
+    const auto remember_table = make_remember_table();
+    const auto should_glow = floor.get_dungeon_definition().flags.has_not(DungeonFeatureType::DARKNESS) && !ninja;
+    const auto should_mark_glow = view_perma_grids && !view_torch_grids;
+    for (POSITION y = 0; y < floor.height; y++) {
+        const auto is_inner_row = (y > 0) && (y < floor.height - 1);
+        for (POSITION x = 0; x < floor.width; x++) {
+            auto &grid = floor.grid_array[y][x];
+
+            /* Memorize terrain of the grid */
+            if (is_inner_row && (x > 0) && (x < floor.width - 1)) {
+                grid.info |= CAVE_KNOWN;
+            }
+
+            /* Perma-lite the grid */
+            if (should_glow) {
+                grid.info |= CAVE_GLOW;
+            }
+
+            /* Memorize normal features and perma-lit grids (newly and previously) */
+            if (is_remembered(remember_table, grid) || (should_mark_glow && any_bits(grid.info, CAVE_GLOW))) {
+                grid.info |= CAVE_MARK;
+            }
+        }
+    }
+}
+}
 
 /*
  * @brief 啓蒙/陽光召喚処理
@@ -76,50 +146,7 @@ void wiz_lite(PlayerType *player_ptr, bool ninja)
     }
 
     /* Scan all normal grids */
-    const auto &terrains = TerrainList::get_instance();
-    for (POSITION y = 1; y < floor.height - 1; y++) {
-        /* Scan all normal grids */
-        for (POSITION x = 1; x < floor.width - 1; x++) {
-            auto *g_ptr = &floor.grid_array[y][x];
-
-            /* Memorize terrain of the grid */
-            g_ptr->info |= (CAVE_KNOWN);
-
-            /* Feature code (applying "mimic" field) */
-            FEAT_IDX feat = g_ptr->get_feat_mimic();
-            auto *t_ptr = &terrains[feat];
-
-            /* Scan all neighbors */
-            for (OBJECT_IDX i = 0; i < 9; i++) {
-                POSITION yy = y + ddy_ddd[i];
-                POSITION xx = x + ddx_ddd[i];
-                g_ptr = &floor.grid_array[yy][xx];
-
-                /* Feature code (applying "mimic" field) */
-                t_ptr = &terrains[g_ptr->get_feat_mimic()];
-
-                /* Perma-lite the grid */
-                if (floor.get_dungeon_definition().flags.has_not(DungeonFeatureType::DARKNESS) && !ninja) {
-                    g_ptr->info |= (CAVE_GLOW);
-                }
-
-                /* Memorize normal features */
-                if (t_ptr->flags.has(TerrainCharacteristics::REMEMBER)) {
-                    /* Memorize the grid */
-                    g_ptr->info |= (CAVE_MARK);
-                }
-
-                /* Perma-lit grids (newly and previously) */
-                else if (g_ptr->info & CAVE_GLOW) {
-                    /* Normally, memorize floors (see above) */
-                    if (view_perma_grids && !view_torch_grids) {
-                        /* Memorize the grid */
-                        g_ptr->info |= (CAVE_MARK);
-                    }
-                }
-            }
-        }
-    }
+    lite_whole_floor(floor, ninja);
 
     auto &rfu = RedrawingFlagsUpdater::get_instance();
     rfu.set_flag(StatusRecalculatingFlag::MONSTER_STATUSES);
@@ -211,42 +238,26 @@ void map_area(PlayerType *player_ptr, POSITION range)
         range /= 3;
     }
 
-    /* Scan that area */
-    const auto &terrains = TerrainList::get_instance();
-    for (POSITION y = 1; y < floor.height - 1; y++) {
-        for (POSITION x = 1; x < floor.width - 1; x++) {
+    /* Scan that area (distance() は各軸方向の距離を下回らないので、範囲を囲む矩形の内側だけを調べる) */
+    const auto remember_table = make_remember_table();
+    const auto y_min = std::max<POSITION>(1, player_ptr->y - range);
+    const auto y_max = std::min<POSITION>(floor.height - 2, player_ptr->y + range);
+    const auto x_min = std::max<POSITION>(1, player_ptr->x - range);
+    const auto x_max = std::min<POSITION>(floor.width - 2, player_ptr->x + range);
+    for (auto y = y_min; y <= y_max; y++) {
+        for (auto x = x_min; x <= x_max; x++) {
             if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
                 continue;
             }
 
-            Grid *g_ptr;
-            g_ptr = &floor.grid_array[y][x];
-
             /* Memorize terrain of the grid */
-            g_ptr->info |= (CAVE_KNOWN);
-
-            /* Feature code (applying "mimic" field) */
-            FEAT_IDX feat = g_ptr->get_feat_mimic();
-            auto *t_ptr = &terrains[feat];
-
-            /* Memorize normal features */
-            if (t_ptr->flags.has(TerrainCharacteristics::REMEMBER)) {
-                /* Memorize the object */
-                g_ptr->info |= (CAVE_MARK);
-            }
-
-            /* Memorize known walls */
-            for (int i = 0; i < 8; i++) {
-                g_ptr = &floor.grid_array[y + ddy_ddd[i]][x + ddx_ddd[i]];
-
-                /* Feature code (applying "mimic" field) */
-                feat = g_ptr->get_feat_mimic();
-                t_ptr = &terrains[feat];
+            floor.grid_array[y][x].info |= (CAVE_KNOWN);
 
-                /* Memorize walls (etc) */
-                if (t_ptr->flags.has(TerrainCharacteristics::REMEMBER)) {
-                    /* Memorize the walls */
-                    g_ptr->info |= (CAVE_MARK);
+            /* Memorize normal features and known walls */
+            for (int i = 0; i < 9; i++) {
+                auto &grid = floor.grid_array[y + ddy_ddd[i]][x + ddx_ddd[i]];
+                if (is_remembered(remember_table, grid)) {
+                    grid.info |= (CAVE_MARK);
                 }
             }
         }
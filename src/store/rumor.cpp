@@ -62,13 +62,13 @@ static std::string bind_rumor_name(std::string_view base, std::string_view item_
 std::pair<bool, std::vector<std::string>> get_rumor_tokens(std::string rumor)
 {
     constexpr auto num_tokens = 3;
-    char *tmp_tokens[num_tokens];
-    if (tokenize(rumor.data() + 2, num_tokens, tmp_tokens, TOKENIZE_CHECKQUOTE) != num_tokens) {
+    const auto tmp_tokens = tokenize(std::string_view(rumor).substr(2), num_tokens, TOKENIZE_CHECKQUOTE);
+    if (tmp_tokens.size() != num_tokens) {
         msg_print(_("この情報は間違っている。", "This information is wrong."));
         return { false, {} };
     }
 
-    std::vector<std::string> tokens(std::begin(tmp_tokens), std::end(tmp_tokens));
+    std::vector<std::string> tokens(tmp_tokens.begin(), tmp_tokens.end());
     return { true, tokens };
 }
 
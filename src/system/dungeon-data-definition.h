@@ -23,6 +23,7 @@
  */
 #define MAX_ROOMS_ROW (MAX_HGT / BLOCK_HGT)
 #define MAX_ROOMS_COL (MAX_WID / BLOCK_WID)
+static_assert(MAX_ROOMS_COL <= 32);
 
 /*
  * Simple structure to hold a map location
@@ -56,8 +57,8 @@ struct dun_data_type {
     int row_rooms;
     int col_rooms;
 
-    /* Array of which blocks are used */
-    bool room_map[MAX_ROOMS_ROW][MAX_ROOMS_COL];
+    /* Bit flags of which blocks are used (bit x of row y) */
+    uint32_t room_map[MAX_ROOMS_ROW];
 
     /* Various type of dungeon floors */
     bool destroyed;
@@ -8,6 +8,7 @@
 #include "system/monster-entity.h"
 #include "util/bit-flags-calculator.h"
 #include "util/enum-range.h"
+#include <algorithm>
 
 FloorType::FloorType()
     : quest_number(QuestId::NONE)
@@ -142,3 +143,30 @@ bool FloorType::can_teleport_level(bool to_player) const
     is_invalid_floor &= ironman_downward;
     return this->is_special() || is_invalid_floor;
 }
+
+/*!
+ * @brief アイテムのダンジョンの雰囲気への寄与を次の雰囲気の算出時に求め直させる
+ * @param o_idx 生成・削除・変化したアイテムの添字
+ * @details 同じアイテムを何度無効化しても、求め直すのは1度だけで済む.
+ */
+void FloorType::invalidate_item_feeling(OBJECT_IDX o_idx)
+{
+    auto &feeling = this->o_feeling_list[o_idx];
+    if (feeling.is_stale) {
+        return;
+    }
+
+    feeling.is_stale = true;
+    this->o_feeling_stale_list.push_back(o_idx);
+}
+
+/*!
+ * @brief 全てのアイテムのダンジョンの雰囲気への寄与を破棄する (アイテムを全て削除した時に呼ぶ)
+ */
+void FloorType::reset_item_feelings()
+{
+    std::fill(this->o_feeling_list.begin(), this->o_feeling_list.end(), ItemFeelingRating{});
+    this->o_feeling_stale_list.clear();
+    this->item_feeling_rating = 0;
+    this->num_feeling_artifacts = 0;
+}
@@ -34,6 +34,15 @@ constexpr auto VIEW_MAX = 1536;
  */
 constexpr auto REDRAW_MAX = 2298;
 
+/*!
+ * @brief アイテム1つ分のダンジョンの雰囲気への寄与
+ */
+struct ItemFeelingRating {
+    int rating = 0; //!< 評価値 (雰囲気に数えないアイテムは0)
+    bool is_artifact = false; //!< 雰囲気に数えるアーティファクトか
+    bool is_stale = false; //!< 求め直す必要があるか
+};
+
 enum class QuestId : short;
 struct dungeon_type;
 class Grid;
@@ -57,13 +66,20 @@ public:
     std::vector<ItemEntity> o_list; /*!< The array of dungeon items [max_o_idx] */
     OBJECT_IDX o_max = 0; /* Number of allocated objects */
     OBJECT_IDX o_cnt = 0; /* Number of live objects */
+    std::vector<OBJECT_IDX> o_free_list; /*!< 削除されたアイテムの添字 (o_pop() で再利用する) */
+    std::vector<ItemFeelingRating> o_feeling_list; /*!< アイテム毎のダンジョンの雰囲気への寄与 [max_o_idx] */
+    std::vector<OBJECT_IDX> o_feeling_stale_list; /*!< 雰囲気への寄与を求め直すアイテムの添字 */
+    int item_feeling_rating = 0; /*!< o_feeling_list の評価値の合計 */
+    int num_feeling_artifacts = 0; /*!< o_feeling_list で雰囲気に数えているアーティファクトの数 */
 
     std::vector<MonsterEntity> m_list; /*!< The array of dungeon monsters [max_m_idx] */
     MONSTER_IDX m_max = 0; /* Number of allocated monsters */
     MONSTER_IDX m_cnt = 0; /* Number of live monsters */
+    std::vector<MONSTER_IDX> m_free_list; /*!< 削除されたモンスターの添字 (m_pop() で再利用する) */
 
     std::vector<int16_t> mproc_list[MAX_MTIMED]{}; /*!< The array to process dungeon monsters[max_m_idx] */
     int16_t mproc_max[MAX_MTIMED]{}; /*!< Number of monsters to be processed */
+    std::vector<int16_t> mproc_pos[MAX_MTIMED]{}; /*!< モンスター毎の mproc_list 内の位置 [max_m_idx] (リストの内容と一致する時のみ有効) */
 
     POSITION_IDX lite_n = 0; //!< Array of grids lit by player lite
     std::array<POSITION, LITE_MAX> lite_y{};
@@ -97,4 +113,6 @@ public:
     bool has_los(const Pos2D pos) const;
     bool is_special() const;
     bool can_teleport_level(bool to_player = false) const;
+    void invalidate_item_feeling(OBJECT_IDX o_idx);
+    void reset_item_feelings();
 };
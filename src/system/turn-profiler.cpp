@@ -0,0 +1,142 @@
+#include "system/turn-profiler.h"
+#include "system/angband-version.h"
+#include "term/z-form.h"
+#include "util/enum-converter.h"
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <string_view>
+
+namespace {
+constexpr std::array<std::string_view, enum2i(TurnPhase::MAX)> TURN_PHASE_NAMES = {
+    "process_player",
+    "process_upkeep",
+    "process_monsters",
+    "process_world",
+    "update_creature",
+    "redraw_stuff",
+    "window_stuff",
+    "update_view",
+    "update_flow",
+    "term_fresh",
+    "input_latency",
+};
+}
+
+TurnProfiler TurnProfiler::instance{};
+
+TurnProfiler &TurnProfiler::get_instance()
+{
+    return instance;
+}
+
+/*!
+ * @brief 集計結果を破棄して計測を開始する
+ */
+void TurnProfiler::start()
+{
+    this->turns = 0;
+    this->key_input_at.reset();
+    this->statistics = {};
+    enabled = true;
+}
+
+void TurnProfiler::stop()
+{
+    enabled = false;
+}
+
+/*!
+ * @brief 計測中のゲームターン数を数える
+ */
+void TurnProfiler::count_turn()
+{
+    if (enabled) {
+        this->turns++;
+    }
+}
+
+/*!
+ * @brief 処理1回分の所要時間を集計する
+ * @param phase 処理区分
+ * @param elapsed 所要時間
+ */
+void TurnProfiler::record(TurnPhase phase, std::chrono::steady_clock::duration elapsed)
+{
+    auto &stat = this->statistics[enum2i(phase)];
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    const auto us = static_cast<uint64_t>(std::max<int64_t>(ns.count() / 1000, 0));
+    const auto bucket = std::min<int>(std::bit_width(us), NUM_BUCKETS - 1);
+    stat.calls++;
+    stat.total += ns;
+    stat.max = std::max(stat.max, ns);
+    stat.histogram[bucket]++;
+}
+
+/*!
+ * @brief キー入力を受け取った時刻を記録する
+ * @details 画面の更新前に続けて入力されたキーは、最初のキーからの経過時間のみを計測する.
+ */
+void TurnProfiler::mark_key_input()
+{
+    if (enabled && !this->key_input_at) {
+        this->key_input_at = std::chrono::steady_clock::now();
+    }
+}
+
+/*!
+ * @brief 画面の更新が終わった時点で、直前のキー入力からの経過時間を記録する
+ */
+void TurnProfiler::finish_key_input()
+{
+    if (!enabled || !this->key_input_at) {
+        return;
+    }
+
+    this->record(TurnPhase::INPUT_LATENCY, std::chrono::steady_clock::now() - *this->key_input_at);
+    this->key_input_at.reset();
+}
+
+/*!
+ * @brief 集計結果をテキストファイルに書き出す
+ * @param path 出力先
+ * @return 書き出しに成功したらtrue
+ * @details process_player はキー入力待ちの時間を含む.
+ */
+bool TurnProfiler::dump(const std::filesystem::path &path) const
+{
+    std::ofstream ofs(path);
+    if (!ofs) {
+        return false;
+    }
+
+    ofs << format("# Turn profile for %s (%llu game turns)\n", get_version().data(), static_cast<unsigned long long>(this->turns));
+    ofs << "# process_player includes the time spent waiting for key input\n";
+    ofs << format("%-16s %10s %12s %10s %10s %10s\n", "phase", "calls", "total(ms)", "mean(us)", "max(us)", "us/turn");
+    for (auto i = 0; i < enum2i(TurnPhase::MAX); i++) {
+        const auto &stat = this->statistics[i];
+        const auto total_us = stat.total.count() / 1000.0;
+        const auto mean_us = stat.calls > 0 ? total_us / stat.calls : 0.0;
+        const auto per_turn_us = this->turns > 0 ? total_us / this->turns : 0.0;
+        ofs << format("%-16s %10llu %12.3f %10.2f %10lld %10.2f\n", TURN_PHASE_NAMES[i].data(), static_cast<unsigned long long>(stat.calls), total_us / 1000.0,
+            mean_us, static_cast<long long>(stat.max.count() / 1000), per_turn_us);
+    }
+
+    ofs << "\n# Histogram of elapsed time (bucket n counts calls taking [2^(n-1), 2^n) us; the last bucket is open-ended)\n";
+    ofs << format("%-16s", "phase");
+    for (auto bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+        ofs << format(" %7d", bucket);
+    }
+
+    ofs << '\n';
+    for (auto i = 0; i < enum2i(TurnPhase::MAX); i++) {
+        ofs << format("%-16s", TURN_PHASE_NAMES[i].data());
+        for (const auto count : this->statistics[i].histogram) {
+            ofs << format(" %7llu", static_cast<unsigned long long>(count));
+        }
+
+        ofs << '\n';
+    }
+
+    return ofs.good();
+}
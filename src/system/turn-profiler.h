@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+/*!
+ * @brief 計測対象となるゲームターン内の処理区分
+ */
+enum class TurnPhase {
+    PROCESS_PLAYER,
+    PROCESS_UPKEEP,
+    PROCESS_MONSTERS,
+    PROCESS_WORLD,
+    UPDATE_CREATURE,
+    REDRAW_STUFF,
+    WINDOW_STUFF,
+    UPDATE_VIEW,
+    UPDATE_FLOW,
+    TERM_FRESH,
+    INPUT_LATENCY, //!< キー入力から次に画面を更新し終えるまで
+    MAX,
+};
+
+/*!
+ * @brief ゲームターン内の処理時間を区分毎に集計する
+ * @details 計測が無効な間は TurnProfileScope の構築時に分岐1つを評価するのみで、時刻の取得も行わない.
+ */
+class TurnProfiler {
+public:
+    TurnProfiler(const TurnProfiler &) = delete;
+    TurnProfiler(TurnProfiler &&) = delete;
+    TurnProfiler &operator=(const TurnProfiler &) = delete;
+    TurnProfiler &operator=(TurnProfiler &&) = delete;
+
+    static TurnProfiler &get_instance();
+    static bool is_enabled()
+    {
+        return enabled;
+    }
+
+    void start();
+    void stop();
+    void count_turn();
+    void record(TurnPhase phase, std::chrono::steady_clock::duration elapsed);
+    void mark_key_input();
+    void finish_key_input();
+    bool dump(const std::filesystem::path &path) const;
+
+private:
+    TurnProfiler() = default;
+
+    static constexpr auto NUM_BUCKETS = 16; //!< 1μs未満から2^14μs以上まで、2倍刻みのヒストグラム
+
+    struct PhaseStatistics {
+        uint64_t calls = 0;
+        std::chrono::nanoseconds total{};
+        std::chrono::nanoseconds max{};
+        std::array<uint64_t, NUM_BUCKETS> histogram{};
+    };
+
+    static TurnProfiler instance;
+    static inline bool enabled = false;
+    uint64_t turns = 0;
+    std::optional<std::chrono::steady_clock::time_point> key_input_at;
+    std::array<PhaseStatistics, static_cast<size_t>(TurnPhase::MAX)> statistics{};
+};
+
+/*!
+ * @brief スコープの生存期間を TurnProfiler に記録する
+ */
+class TurnProfileScope {
+public:
+    explicit TurnProfileScope(TurnPhase phase)
+        : phase(phase)
+        , is_active(TurnProfiler::is_enabled())
+    {
+        if (this->is_active) {
+            this->started_at = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TurnProfileScope()
+    {
+        if (this->is_active) {
+            TurnProfiler::get_instance().record(this->phase, std::chrono::steady_clock::now() - this->started_at);
+        }
+    }
+
+    TurnProfileScope(const TurnProfileScope &) = delete;
+    TurnProfileScope &operator=(const TurnProfileScope &) = delete;
+
+private:
+    TurnPhase phase;
+    bool is_active;
+    std::chrono::steady_clock::time_point started_at{};
+};
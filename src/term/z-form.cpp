@@ -82,17 +82,33 @@
 #include "term/z-form.h"
 #include "term/z-util.h"
 #include "term/z-virt.h"
+#include <array>
 #include <span>
 #include <vector>
 
 namespace {
+/*!
+ * @brief 書式化した文字列を返す
+ * @details 大抵の文字列はスタック上の領域に収まるので、ヒープ領域の確保は戻り値の生成時のみとする.
+ */
 std::string vformat(const char *fmt, va_list vp)
 {
-    std::vector<char> format_buf(1024);
+    std::array<char, 1024> stack_buf;
+    va_list vp_copy;
+    va_copy(vp_copy, vp);
+    const auto stack_len = vstrnfmt(stack_buf.data(), stack_buf.size(), fmt, vp_copy);
+    va_end(vp_copy);
+    if (stack_len < stack_buf.size() - 1) {
+        return std::string(stack_buf.data(), stack_len);
+    }
+
+    std::vector<char> format_buf(stack_buf.size() * 2);
     while (true) {
-        const auto len = vstrnfmt(format_buf.data(), format_buf.size(), fmt, vp);
+        va_copy(vp_copy, vp);
+        const auto len = vstrnfmt(format_buf.data(), format_buf.size(), fmt, vp_copy);
+        va_end(vp_copy);
         if (len < format_buf.size() - 1) {
-            return std::string(format_buf.data());
+            return std::string(format_buf.data(), len);
         }
 
         format_buf.resize(format_buf.size() * 2);
@@ -155,9 +171,9 @@ uint32_t vstrnfmt(char *buf, uint32_t max, const char *fmt, va_list vp)
         auto do_capitalize = false;
 
         /* Format sequence */
-        std::string aux;
-        aux.reserve(128);
-        aux.push_back('%');
+        std::array<char, 128> aux;
+        auto aux_len = 0;
+        aux[aux_len++] = '%';
 
         /* Build the format sequence string */
         while (true) {
@@ -168,7 +184,7 @@ uint32_t vstrnfmt(char *buf, uint32_t max, const char *fmt, va_list vp)
             }
 
             /* Error -- format sequence may be too long */
-            if (aux.length() > 100) {
+            if (aux_len > 100) {
                 buf[0] = '\0';
                 return 0;
             }
@@ -176,9 +192,9 @@ uint32_t vstrnfmt(char *buf, uint32_t max, const char *fmt, va_list vp)
             if (isalpha(*s)) {
                 /* handle "long" or "long long" request */
                 if (*s == 'l') {
-                    aux.push_back(*s++);
+                    aux[aux_len++] = *s++;
                     if (*s == 'l') {
-                        aux.push_back(*s++);
+                        aux[aux_len++] = *s++;
                         do_long_long = true;
                     } else {
                         do_long = true;
@@ -187,35 +203,38 @@ uint32_t vstrnfmt(char *buf, uint32_t max, const char *fmt, va_list vp)
 
                 /* handle "long double" request */
                 else if (*s == 'L') {
-                    aux.push_back(*s++);
+                    aux[aux_len++] = *s++;
                     do_long_double = true;
                 }
 
                 /* Handle normal end of format sequence */
                 else {
-                    aux.push_back(*s++);
+                    aux[aux_len++] = *s++;
                     break;
                 }
             } else {
                 /* Handle 'star' (for "variable length" argument) */
                 if (*s == '*') {
                     auto arg = va_arg(vp, int);
-                    aux.append(std::to_string(arg));
+                    aux_len += snprintf(aux.data() + aux_len, aux.size() - aux_len, "%d", arg);
                     s++;
                 }
 
                 /* Collect "normal" characters (digits, "-", "+", ".", etc) */
                 else {
-                    aux.push_back(*s++);
+                    aux[aux_len++] = *s++;
                 }
             }
         }
 
+        aux[aux_len] = '\0';
+
         /* Resulting string */
-        char tmp[1024]{};
+        char tmp[1024];
+        tmp[0] = '\0';
 
         /* Process the "format" char */
-        switch (aux.back()) {
+        switch (aux[aux_len - 1]) {
         /* Simple Character -- standard format */
         case 'c': {
             auto arg = va_arg(vp, int);
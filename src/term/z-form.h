@@ -8,7 +8,9 @@
  */
 
 #include "system/h-basic.h"
+#include <array>
 #include <string>
+#include <string_view>
 
 uint32_t vstrnfmt(char *buf, uint32_t max, const char *fmt, va_list vp);
 uint32_t strnfmt(char *buf, uint32_t max, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
@@ -16,3 +18,38 @@ std::string format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
 void plog_fmt(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
 void quit_fmt(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
 void core_fmt(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+/*!
+ * @brief 書式化した文字列を、ヒープ領域を確保せずに保持する
+ * @tparam N 領域の大きさ (終端文字を含む). 収まらない部分は切り捨てる
+ * @details 書式文字列は format() と同様にコンパイル時に検査される.
+ * 再描画処理のように短い文字列を大量に書式化する箇所で、一時オブジェクトとして format() の代わりに用いる.
+ */
+template <size_t N = 128>
+class FormatBuffer {
+public:
+    FormatBuffer(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list vp;
+        va_start(vp, fmt);
+        this->length = vstrnfmt(this->buf.data(), N, fmt, vp);
+        va_end(vp);
+    }
+
+    FormatBuffer(const FormatBuffer &) = delete;
+    FormatBuffer &operator=(const FormatBuffer &) = delete;
+
+    operator std::string_view() const
+    {
+        return { this->buf.data(), this->length };
+    }
+
+    const char *data() const
+    {
+        return this->buf.data();
+    }
+
+private:
+    std::array<char, N> buf;
+    uint32_t length;
+};
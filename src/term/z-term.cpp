@@ -11,6 +11,7 @@
 #include "game-option/map-screen-options.h"
 #include "game-option/runtime-arguments.h"
 #include "game-option/special-options.h"
+#include "system/turn-profiler.h"
 #include "term/gameterm.h"
 #include "term/term-color-types.h"
 #include "term/z-virt.h"
@@ -1105,6 +1106,7 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
  */
 errr term_fresh(void)
 {
+    TurnProfileScope profile_scope(TurnPhase::TERM_FRESH);
     int w = game_term->wid;
     int h = game_term->hgt;
 
@@ -1328,6 +1330,7 @@ errr term_fresh(void)
 
     /* Actually flush the output */
     term_xtra(TERM_XTRA_FRESH, 0);
+    TurnProfiler::get_instance().finish_key_input();
 
     if (!game_term->soft_cursor && !scr->cu && scr->cv) {
         /* The cursor is visible, display it correctly */
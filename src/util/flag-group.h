@@ -512,6 +512,23 @@ public:
         return std::nullopt;
     }
 
+    /**
+     * @brief フラグ集合のONになっているフラグのうち、番号の小さい方から数えてn番目(0始まり)のフラグを返す
+     *
+     * @param n 何番目のフラグを返すか
+     * @return n番目のフラグ。但しONになっているフラグがn個以下なら std::nullopt
+     */
+    [[nodiscard]] std::optional<FlagType> nth(size_t n) const noexcept
+    {
+        for (size_t i = 0; i < bs_.size(); i++) {
+            if (bs_.test(i) && (n-- == 0)) {
+                return static_cast<FlagType>(i);
+            }
+        }
+
+        return std::nullopt;
+    }
+
     /**
      * @brief フラグ集合の状態を0と1で表した文字列を返す
      *
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+/*!
+ * @brief 文字列をキーとする完全ハッシュ表の格納領域
+ * @tparam T 値の型
+ * @tparam N 要素数
+ * @details make_perfect_hash_table() によりコンパイル時に構築する.
+ * キーを一旦バケットに振り分け、バケット毎に衝突しないシードを探すことで全てのキーを異なるスロットに割り当てる (hash and displace).
+ */
+template <typename T, size_t N>
+struct PerfectHashTableStorage {
+    static_assert(N > 0);
+    static_assert(N <= UINT16_MAX);
+    static constexpr auto NUM_SLOTS = std::bit_ceil(N * 2);
+
+    std::array<std::pair<std::string_view, T>, N> entries{}; //!< 登録順の要素
+    std::array<uint32_t, N> seeds{}; //!< バケット毎のシード
+    std::array<uint16_t, NUM_SLOTS> slots{}; //!< スロット毎の要素番号 (空きスロットは0)
+};
+
+/*!
+ * @brief 完全ハッシュ表で用いるハッシュ関数 (シード付きFNV-1a)
+ */
+constexpr uint32_t perfect_hash(std::string_view key, uint32_t seed)
+{
+    auto hash = 2166136261U ^ seed;
+    for (const auto c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619U;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+/*!
+ * @brief 文字列をキーとする、読み取り専用の完全ハッシュ表
+ * @tparam T 値の型
+ * @details 格納領域の要素数を型から消去した参照で、検索はハッシュ値の計算2回と文字列の比較1回で済む.
+ * std::unordered_map の代わりに使えるよう、find() と end() は同じ形で提供する.
+ */
+template <typename T>
+class PerfectHashTable {
+public:
+    using key_type = std::string_view;
+    using mapped_type = T;
+    using value_type = std::pair<std::string_view, T>;
+    using iterator = const value_type *;
+
+    template <size_t N>
+    constexpr PerfectHashTable(const PerfectHashTableStorage<T, N> &storage)
+        : entries(storage.entries)
+        , seeds(storage.seeds)
+        , slots(storage.slots)
+    {
+    }
+
+    constexpr iterator find(std::string_view key) const
+    {
+        const auto seed = this->seeds[perfect_hash(key, 0) % this->seeds.size()];
+        const auto &entry = this->entries[this->slots[perfect_hash(key, seed) & (this->slots.size() - 1)]];
+        return entry.first == key ? &entry : this->end();
+    }
+
+    constexpr iterator begin() const
+    {
+        return this->entries.data();
+    }
+
+    constexpr iterator end() const
+    {
+        return this->entries.data() + this->entries.size();
+    }
+
+    constexpr size_t size() const
+    {
+        return this->entries.size();
+    }
+
+private:
+    std::span<const value_type> entries;
+    std::span<const uint32_t> seeds;
+    std::span<const uint16_t> slots;
+};
+
+/*!
+ * @brief キーと値の組の一覧から完全ハッシュ表をコンパイル時に構築する
+ * @tparam T 値の型
+ * @param entries キーと値の組の一覧
+ * @return 完全ハッシュ表の格納領域
+ * @details キーの重複や、シードが見つからない場合はコンパイルエラーとなる.
+ */
+template <typename T, size_t N>
+consteval PerfectHashTableStorage<T, N> make_perfect_hash_table(const std::pair<std::string_view, T> (&entries)[N])
+{
+    PerfectHashTableStorage<T, N> storage{};
+    std::array<size_t, N> buckets{};
+    std::array<size_t, N> bucket_sizes{};
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (entries[i].first == entries[j].first) {
+                throw std::invalid_argument("Duplicated key in perfect hash table");
+            }
+        }
+
+        storage.entries[i] = entries[i];
+        buckets[i] = perfect_hash(entries[i].first, 0) % N;
+        bucket_sizes[buckets[i]]++;
+    }
+
+    std::array<size_t, N> bucket_order{};
+    for (size_t b = 0; b < N; b++) {
+        bucket_order[b] = b;
+    }
+
+    std::sort(bucket_order.begin(), bucket_order.end(), [&bucket_sizes](auto a, auto b) { return bucket_sizes[a] > bucket_sizes[b]; });
+    std::array<bool, PerfectHashTableStorage<T, N>::NUM_SLOTS> is_used{};
+    for (const auto bucket : bucket_order) {
+        if (bucket_sizes[bucket] == 0) {
+            break;
+        }
+
+        std::array<size_t, N> members{};
+        size_t num_members = 0;
+        for (size_t i = 0; i < N; i++) {
+            if (buckets[i] == bucket) {
+                members[num_members++] = i;
+            }
+        }
+
+        constexpr uint32_t MAX_SEED = 100000;
+        auto is_found = false;
+        for (uint32_t seed = 1; !is_found && (seed < MAX_SEED); seed++) {
+            std::array<size_t, N> member_slots{};
+            is_found = true;
+            for (size_t m = 0; is_found && (m < num_members); m++) {
+                const auto slot = perfect_hash(entries[members[m]].first, seed) & (PerfectHashTableStorage<T, N>::NUM_SLOTS - 1);
+                is_found = !is_used[slot] && (std::find(member_slots.begin(), member_slots.begin() + m, slot) == member_slots.begin() + m);
+                member_slots[m] = slot;
+            }
+
+            if (!is_found) {
+                continue;
+            }
+
+            storage.seeds[bucket] = seed;
+            for (size_t m = 0; m < num_members; m++) {
+                is_used[member_slots[m]] = true;
+                storage.slots[member_slots[m]] = static_cast<uint16_t>(members[m]);
+            }
+        }
+
+        if (!is_found) {
+            throw std::logic_error("Seed for perfect hash table is not found");
+        }
+    }
+
+    return storage;
+}
@@ -648,46 +648,3 @@ bool ang_sort_comp_pet_dismiss(PlayerType *player_ptr, vptr u, vptr v, int a, in
 
     return w1 <= w2;
 }
-
-/*!
- * @brief フロア保存時のgrid情報テンプレートをソートするための比較処理
- * @param u gridテンプレートの参照ポインタ
- * @param v 未使用
- * @param a スワップするモンスター種族のID1
- * @param b スワップするモンスター種族のID2
- * @return aの方が大きければtrue
- */
-bool ang_sort_comp_cave_temp(PlayerType *player_ptr, vptr u, vptr v, int a, int b)
-{
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    grid_template_type *who = (grid_template_type *)(u);
-
-    uint16_t o1 = who[a].occurrence;
-    uint16_t o2 = who[b].occurrence;
-
-    return o2 <= o1;
-}
-
-/*!
- * @brief フロア保存時のgrid情報テンプレートをソートするためのスワップ処理 / Sorting hook -- Swap function
- * @param u gridテンプレートの参照ポインタ
- * @param v 未使用
- * @param a スワップするモンスター種族のID1
- * @param b スワップするモンスター種族のID2
- */
-void ang_sort_swap_cave_temp(PlayerType *player_ptr, vptr u, vptr v, int a, int b)
-{
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    grid_template_type *who = (grid_template_type *)(u);
-    grid_template_type holder;
-
-    holder = who[a];
-    who[a] = who[b];
-    who[b] = holder;
-}
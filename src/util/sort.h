@@ -23,6 +23,3 @@ void ang_sort_swap_hook(PlayerType *player_ptr, vptr u, vptr v, int a, int b);
 
 bool ang_sort_comp_monster_level(PlayerType *player_ptr, vptr u, vptr v, int a, int b);
 bool ang_sort_comp_pet_dismiss(PlayerType *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_cave_temp(PlayerType *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_cave_temp(PlayerType *player_ptr, vptr u, vptr v, int a, int b);
@@ -0,0 +1,110 @@
+#include "util/text-file-reader.h"
+#include "locale/japanese.h"
+#include "util/angband-files.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+/*!
+ * @brief ファイルの内容を一括で読み込む
+ * @param path ファイルパス
+ * @details 開けなかった場合は is_open() がfalseを返す.
+ */
+TextFileReader::TextFileReader(const std::filesystem::path &path)
+{
+    auto *fp = angband_fopen(path, FileOpenMode::READ, true);
+    if (fp == nullptr) {
+        return;
+    }
+
+    if ((fseek(fp, 0, SEEK_END) == 0) && (ftell(fp) > 0)) {
+        this->contents.resize(ftell(fp));
+        rewind(fp);
+        this->contents.resize(fread(this->contents.data(), 1, this->contents.size(), fp));
+    }
+
+    this->is_opened = ferror(fp) == 0;
+    angband_fclose(fp);
+}
+
+bool TextFileReader::is_open() const
+{
+    return this->is_opened;
+}
+
+/*!
+ * @brief 次の1行を返す
+ * @return 行の内容. ファイルの終端に達していたらnullopt
+ * @details 返した文字列は、次に read_line() を呼ぶかこのオブジェクトが破棄されるまで有効.
+ */
+std::optional<std::string_view> TextFileReader::read_line()
+{
+    if (this->pos >= this->contents.size()) {
+        return std::nullopt;
+    }
+
+    const std::string_view rest(this->contents.data() + this->pos, this->contents.size() - this->pos);
+    auto end = rest.find('\n');
+    if (end == std::string_view::npos) {
+        end = rest.size();
+        this->pos = this->contents.size();
+    } else {
+        this->pos += end + 1;
+    }
+
+    auto line = rest.substr(0, end);
+    if (line.ends_with('\r')) {
+        line.remove_suffix(1);
+    }
+
+    const auto is_printable = [](char c) { return (c >= 0x20) && (c < 0x7f); };
+    if (std::all_of(line.begin(), line.end(), is_printable)) {
+        return line;
+    }
+
+    return this->sanitize(line);
+}
+
+/*!
+ * @brief タブや表示できない文字を含む行を angband_fgets() と同じ規則で置き換える
+ * @param raw_line ファイル中の行
+ * @return 置き換えた行
+ */
+std::string_view TextFileReader::sanitize(std::string_view raw_line)
+{
+#ifdef JP
+    this->convert_buf.assign(raw_line);
+    guess_convert_to_system_encoding(this->convert_buf.data(), this->convert_buf.size() + 1);
+    raw_line = this->convert_buf.data();
+#endif
+
+    this->line_buf.clear();
+    for (size_t i = 0; i < raw_line.size(); i++) {
+        const auto c = raw_line[i];
+        if (c == '\t') {
+            do {
+                this->line_buf.push_back(' ');
+            } while ((this->line_buf.size() % 8) != 0);
+        }
+#ifdef JP
+        else if (iskanji(c)) {
+            if (i + 1 >= raw_line.size()) {
+                break;
+            }
+
+            this->line_buf.push_back(c);
+            this->line_buf.push_back(raw_line[++i]);
+        } else if (iskana(c)) {
+            /* 半角かなに対応 */
+            this->line_buf.push_back(c);
+        }
+#endif
+        else if (isprint(static_cast<unsigned char>(c))) {
+            this->line_buf.push_back(c);
+        } else {
+            this->line_buf.push_back('?');
+        }
+    }
+
+    return this->line_buf;
+}
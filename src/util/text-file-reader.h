@@ -0,0 +1,31 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/*!
+ * @brief テキストファイルを一括で読み込み、1行ずつ返す
+ * @details 返す行は改行を含まず、angband_fgets() と同様にタブを空白に、表示できない文字を'?'に置き換える.
+ * 置き換えや文字コードの変換が不要な行はファイルの内容を直接指すため、行毎の複写を伴わない.
+ * angband_fgets() と異なり、行の長さに上限はない.
+ */
+class TextFileReader {
+public:
+    explicit TextFileReader(const std::filesystem::path &path);
+
+    bool is_open() const;
+    std::optional<std::string_view> read_line();
+
+private:
+    bool is_opened = false;
+    std::string contents;
+    size_t pos = 0;
+    std::string line_buf; //!< 置き換えが必要な行の格納先
+#ifdef JP
+    std::string convert_buf; //!< 文字コード変換の作業領域
+#endif
+
+    std::string_view sanitize(std::string_view raw_line);
+};
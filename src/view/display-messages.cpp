@@ -12,10 +12,12 @@
 #include "term/term-color-types.h"
 #include "util/int-char-converter.h"
 #include "world/world.h"
-#include <deque>
-#include <map>
-#include <memory>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
 #include <string>
+#include <utility>
+#include <vector>
 
 /* Used in msg_print() for "buffering" */
 bool msg_flag;
@@ -27,42 +29,147 @@ namespace {
 /*! 表示するメッセージの先頭位置 */
 static int msg_head_pos = 0;
 
-using msg_sp = std::shared_ptr<const std::string>;
-using msg_wp = std::weak_ptr<const std::string>;
+/*! 同一メッセージの連続回数の上限 */
+constexpr auto MESSAGE_REPEAT_MAX = 1000;
 
-/** メッセージが同一かどうかを比較するためのラムダ式 */
-auto string_ptr_cmp = [](const std::string *a, const std::string *b) { return *a < *b; };
+/*! 連続回数表記「 <xNNNN>」のために各メッセージの後ろに確保しておくバイト数 (終端の'\0'を含む) */
+constexpr auto MESSAGE_SUFFIX_RESERVE = sizeof(" <x1000>");
 
-/** 同一メッセージの検索に使用するmapオブジェクト。
- * 同一メッセージがあるかどうかを検索し、ヒットしたらweak_ptrからshared_ptrを作成しメッセージを共有する。
- * message_historyのカスタムデリータの中で参照するので、message_historyより先に宣言しなければならない事に注意。
+/*! メッセージ本文を格納するリングバッファのバイト数 (MESSAGE_MAX 件の最長メッセージを保持できる大きさ) */
+constexpr auto MESSAGE_BUFFER_SIZE = MESSAGE_MAX * (MAIN_TERM_MIN_COLS + MESSAGE_SUFFIX_RESERVE);
+
+/*!
+ * @brief メッセージ履歴を保持する固定長のリングバッファ
+ * @details メッセージ本文は連続したバイト列に'\0'終端付きで書き込み、各メッセージの位置と長さ、
+ * 同一メッセージの連続回数はインデックス側に別途保持する.
+ * 連続回数表記「 <xN>」は最新のメッセージの末尾を直接書き換えて更新する.
+ * 容量が不足した場合は古いメッセージから順に破棄する.
  */
-std::map<const std::string *, msg_wp, decltype(string_ptr_cmp)> message_map(string_ptr_cmp);
+class MessageHistory {
+public:
+    MessageHistory()
+        : buffer(MESSAGE_BUFFER_SIZE)
+        , entries(MESSAGE_MAX)
+    {
+    }
+
+    int size() const
+    {
+        return this->count;
+    }
+
+    std::string_view get(int age) const
+    {
+        const auto &entry = this->entries[this->index_of(age)];
+        return std::string_view(&this->buffer[entry.offset], entry.length);
+    }
+
+    bool is_repeat_of_latest(std::string_view str) const
+    {
+        if (this->count == 0) {
+            return false;
+        }
+
+        const auto &entry = this->entries[this->index_of(0)];
+        return (entry.repeat < MESSAGE_REPEAT_MAX) && (std::string_view(&this->buffer[entry.offset], entry.base_length) == str);
+    }
+
+    void repeat_latest()
+    {
+        auto &entry = this->entries[this->index_of(0)];
+        entry.repeat++;
+        auto *suffix = &this->buffer[entry.offset + entry.base_length];
+        const auto suffix_length = std::snprintf(suffix, MESSAGE_SUFFIX_RESERVE, " <x%d>", entry.repeat);
+        entry.length = static_cast<uint16_t>(entry.base_length + suffix_length);
+    }
+
+    void push(std::string_view str, int repeat)
+    {
+        const auto reserved = str.length() + MESSAGE_SUFFIX_RESERVE;
+        if (this->write_pos + reserved > this->buffer.size()) {
+            this->write_pos = 0;
+        }
+
+        while (this->count > 0) {
+            const auto &oldest = this->entries[this->index_of(this->count - 1)];
+            const auto oldest_end = oldest.offset + oldest.base_length + MESSAGE_SUFFIX_RESERVE;
+            if ((oldest.offset >= this->write_pos + reserved) || (oldest_end <= this->write_pos)) {
+                break;
+            }
+
+            this->count--;
+        }
+
+        this->head = (this->head + 1) % this->entries.size();
+        auto &entry = this->entries[this->head];
+        entry.offset = static_cast<uint32_t>(this->write_pos);
+        entry.base_length = static_cast<uint16_t>(str.length());
+        entry.length = entry.base_length;
+        entry.repeat = 1;
+        std::copy(str.begin(), str.end(), &this->buffer[entry.offset]);
+        this->buffer[entry.offset + entry.length] = '\0';
+        this->write_pos += reserved;
+        this->count++;
+        if (repeat > 1) {
+            entry.repeat = repeat - 1;
+            this->repeat_latest();
+        }
+    }
+
+    void pop_oldest()
+    {
+        if (this->count > 0) {
+            this->count--;
+        }
+    }
+
+private:
+    struct Entry {
+        uint32_t offset = 0; //!< リングバッファ上の開始位置
+        uint16_t base_length = 0; //!< 連続回数表記を除いた本文の長さ
+        uint16_t length = 0; //!< 連続回数表記を含めた長さ
+        int repeat = 1; //!< 同一メッセージの連続回数
+    };
+
+    std::vector<char> buffer;
+    std::vector<Entry> entries;
+    size_t head = 0;
+    int count = 0;
+    size_t write_pos = 0;
+
+    size_t index_of(int age) const
+    {
+        return (this->head + this->entries.size() - age) % this->entries.size();
+    }
+};
 
 /** メッセージ履歴 */
-std::deque<msg_sp> message_history;
+MessageHistory message_history;
 
-/**
- * @brief メッセージを保持する msg_sp オブジェクトを生成する
- *
- * @tparam T メッセージの型。std::string / std::string_view / const char* 等
+/*!
+ * @brief セーブファイル等から読み込んだメッセージ末尾の連続回数表記「 <xN>」を分離する
  * @param str メッセージ
- * @return 生成した msg_sp オブジェクト
+ * @return 連続回数表記を除いたメッセージと連続回数
  */
-template <typename T>
-msg_sp make_message(T &&str)
+std::pair<std::string_view, int> split_repeat_suffix(std::string_view str)
 {
-    /** std::stringオブジェクトと同時にmessage_mapのエントリも削除するカスタムデリータ */
-    auto deleter = [](std::string *s) {
-        message_map.erase(s);
-        delete s;
-    };
+    if (!str.ends_with('>')) {
+        return { str, 1 };
+    }
 
-    // 新たにメッセージを保持する msg_sp オブジェクトを生成し、検索用mapオブジェクトにも追加する
-    auto new_msg = msg_sp(new std::string(std::forward<T>(str)), std::move(deleter));
-    message_map.emplace(new_msg.get(), msg_wp(new_msg));
+    const auto pos = str.rfind(" <x");
+    if (pos == std::string_view::npos) {
+        return { str, 1 };
+    }
 
-    return new_msg;
+    const auto digits = str.substr(pos + 3, str.length() - pos - 4);
+    auto repeat = 0;
+    const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.length(), repeat);
+    if ((ec != std::errc()) || (ptr != digits.data() + digits.length()) || (repeat < 2) || (repeat > MESSAGE_REPEAT_MAX)) {
+        return { str, 1 };
+    }
+
+    return { str.substr(0, pos), repeat };
 }
 }
 
@@ -78,20 +185,20 @@ int32_t message_num(void)
 /*!
  * @brief 過去のゲームメッセージを返す。 / Recall the "text" of a saved message
  * @param age メッセージの世代
- * @return メッセージの文字列ポインタ
+ * @return メッセージの文字列 ('\0'終端が保証され、次にメッセージを追加するまで有効)
  */
-std::shared_ptr<const std::string> message_str(int age)
+std::string_view message_str(int age)
 {
     if ((age < 0) || (age >= message_num())) {
-        return std::make_shared<const std::string>("");
+        return "";
     }
 
-    return message_history[age];
+    return message_history.get(age);
 }
 
-static void message_add_aux(std::string str)
+static void message_add_aux(std::string_view str, int repeat)
 {
-    std::string splitted;
+    std::string_view splitted;
 
     if (str.empty()) {
         return;
@@ -126,61 +233,34 @@ static void message_add_aux(std::string str)
     }
 
     // 直前と同じメッセージの場合、「～ <xNN>」と表示する
-    if (!message_history.empty()) {
-        const char *t;
-        std::string_view last_message = *message_history.front();
-#ifdef JP
-        for (t = last_message.data(); *t && (*t != '<' || (*(t + 1) != 'x')); t++) {
-            if (iskanji(*t)) {
-                t++;
-            }
-        }
-#else
-        for (t = last_message.data(); *t && (*t != '<'); t++) {
-            ;
-        }
-#endif
-        int j = 1;
-        if (*t && t != last_message.data()) {
-            if (last_message.length() >= sizeof(" <xN>") - 1) {
-                last_message = last_message.substr(0, t - last_message.data() - 1);
-                j = atoi(t + 2);
-            }
-        }
-
-        if (str == last_message && (j < 1000)) {
-            str = format("%s <x%d>", str.data(), j + 1);
-            message_history.pop_front();
+    if (message_history.size() > 0) {
+        if ((repeat == 1) && message_history.is_repeat_of_latest(str)) {
+            message_history.repeat_latest();
             if (!now_message) {
                 now_message++;
             }
-        } else {
-            /*流れた行の数を数えておく */
-            num_more++;
-            now_message++;
-        }
-    }
 
-    msg_sp add_msg;
+            if (!splitted.empty()) {
+                message_add_aux(splitted, 1);
+            }
+
+            return;
+        }
 
-    // メッセージ履歴から同一のメッセージを探す
-    if (const auto &it = message_map.find(&str); it != message_map.end()) {
-        // 同一のメッセージが見つかったならそのメッセージの msg_sp オブジェクトを複製
-        add_msg = it->second.lock();
-    } else {
-        // 見つからなかった場合は新たに msg_sp オブジェクトを作成
-        add_msg = make_message(std::move(str));
+        /*流れた行の数を数えておく */
+        num_more++;
+        now_message++;
     }
 
     // メッセージ履歴に追加
-    message_history.push_front(std::move(add_msg));
+    message_history.push(str, repeat);
 
     if (message_history.size() == MESSAGE_MAX) {
-        message_history.pop_back();
+        message_history.pop_oldest();
     }
 
     if (!splitted.empty()) {
-        message_add_aux(std::move(splitted));
+        message_add_aux(splitted, 1);
     }
 }
 
@@ -190,7 +270,8 @@ static void message_add_aux(std::string str)
  */
 void message_add(std::string_view msg)
 {
-    message_add_aux(std::string(msg));
+    const auto &[str, repeat] = split_repeat_suffix(msg);
+    message_add_aux(str, repeat);
 }
 
 bool is_msg_window_flowed(void)
@@ -87,7 +87,7 @@ static void display_sub_hand(PlayerType *player_ptr)
     uint stance_num = enum2i(pc.get_monk_stance()) - 1;
 
     if (stance_num < monk_stances.size()) {
-        display_player_one_line(ENTRY_POSTURE, format(_("%sの構え", "%s form"), monk_stances[stance_num].desc), TERM_YELLOW);
+        display_player_one_line(ENTRY_POSTURE, FormatBuffer(_("%sの構え", "%s form"), monk_stances[stance_num].desc), TERM_YELLOW);
     }
 }
 
@@ -123,7 +123,7 @@ static void display_bow_hit_damage(PlayerType *player_ptr)
     }
 
     show_tohit += player_ptr->skill_thb / BTH_PLUS_ADJ;
-    display_player_one_line(ENTRY_SHOOT_HIT_DAM, format("(%+d,%+d)", show_tohit, show_todam), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SHOOT_HIT_DAM, FormatBuffer("(%+d,%+d)", show_tohit, show_todam), TERM_L_BLUE);
 }
 
 /*!
@@ -142,7 +142,7 @@ static void display_shoot_magnification(PlayerType *player_ptr)
         tmul = tmul * (100 + (int)(adj_str_td[player_ptr->stat_index[A_STR]]) - 128);
     }
 
-    display_player_one_line(ENTRY_SHOOT_POWER, format("x%d.%02d", tmul / 100, tmul % 100), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SHOOT_POWER, FormatBuffer("x%d.%02d", tmul / 100, tmul % 100), TERM_L_BLUE);
 }
 
 /*!
@@ -245,7 +245,7 @@ static void display_player_speed(PlayerType *player_ptr, TERM_COLOR attr, int ba
     }
 
     display_player_one_line(ENTRY_SPEED, buf, attr);
-    display_player_one_line(ENTRY_LEVEL, format("%d", player_ptr->lev), TERM_L_GREEN);
+    display_player_one_line(ENTRY_LEVEL, FormatBuffer("%d", player_ptr->lev), TERM_L_GREEN);
 }
 
 /*!
@@ -257,13 +257,13 @@ static void display_player_exp(PlayerType *player_ptr)
     PlayerRace pr(player_ptr);
     int e = pr.equals(PlayerRaceType::ANDROID) ? ENTRY_EXP_ANDR : ENTRY_CUR_EXP;
     if (player_ptr->exp >= player_ptr->max_exp) {
-        display_player_one_line(e, format("%d", player_ptr->exp), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer("%d", player_ptr->exp), TERM_L_GREEN);
     } else {
-        display_player_one_line(e, format("%d", player_ptr->exp), TERM_YELLOW);
+        display_player_one_line(e, FormatBuffer("%d", player_ptr->exp), TERM_YELLOW);
     }
 
     if (!pr.equals(PlayerRaceType::ANDROID)) {
-        display_player_one_line(ENTRY_MAX_EXP, format("%d", player_ptr->max_exp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_MAX_EXP, FormatBuffer("%d", player_ptr->max_exp), TERM_L_GREEN);
     }
 
     e = pr.equals(PlayerRaceType::ANDROID) ? ENTRY_EXP_TO_ADV_ANDR : ENTRY_EXP_TO_ADV;
@@ -271,9 +271,9 @@ static void display_player_exp(PlayerType *player_ptr)
     if (player_ptr->lev >= PY_MAX_LEVEL) {
         display_player_one_line(e, "*****", TERM_L_GREEN);
     } else if (pr.equals(PlayerRaceType::ANDROID)) {
-        display_player_one_line(e, format("%d", player_exp_a[player_ptr->lev - 1] * player_ptr->expfact / 100), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer("%d", player_exp_a[player_ptr->lev - 1] * player_ptr->expfact / 100), TERM_L_GREEN);
     } else {
-        display_player_one_line(e, format("%d", player_exp[player_ptr->lev - 1] * player_ptr->expfact / 100), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer("%d", player_exp[player_ptr->lev - 1] * player_ptr->expfact / 100), TERM_L_GREEN);
     }
 }
 
@@ -291,19 +291,19 @@ static void display_playtime_in_game(PlayerType *player_ptr)
     display_player_one_line(ENTRY_DAY, mes, TERM_L_GREEN);
 
     if (player_ptr->chp >= player_ptr->mhp) {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_HP, FormatBuffer("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_L_GREEN);
     } else if (player_ptr->chp > (player_ptr->mhp * hitpoint_warn) / 10) {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_YELLOW);
+        display_player_one_line(ENTRY_HP, FormatBuffer("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_YELLOW);
     } else {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_RED);
+        display_player_one_line(ENTRY_HP, FormatBuffer("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_RED);
     }
 
     if (player_ptr->csp >= player_ptr->msp) {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_SP, FormatBuffer("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_L_GREEN);
     } else if (player_ptr->csp > (player_ptr->msp * mana_warn) / 10) {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_YELLOW);
+        display_player_one_line(ENTRY_SP, FormatBuffer("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_YELLOW);
     } else {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_RED);
+        display_player_one_line(ENTRY_SP, FormatBuffer("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_RED);
     }
 }
 
@@ -317,7 +317,7 @@ static void display_real_playtime(void)
     uint32_t play_hour = w_ptr->play_time / (60 * 60);
     uint32_t play_min = (w_ptr->play_time / 60) % 60;
     uint32_t play_sec = w_ptr->play_time % 60;
-    display_player_one_line(ENTRY_PLAY_TIME, format("%.2u:%.2u:%.2u", play_hour, play_min, play_sec), TERM_L_GREEN);
+    display_player_one_line(ENTRY_PLAY_TIME, FormatBuffer("%.2u:%.2u:%.2u", play_hour, play_min, play_sec), TERM_L_GREEN);
 }
 
 /*!
@@ -334,7 +334,7 @@ void display_player_middle(PlayerType *player_ptr)
     display_sub_hand(player_ptr);
     display_bow_hit_damage(player_ptr);
     display_shoot_magnification(player_ptr);
-    display_player_one_line(ENTRY_BASE_AC, format("[%d,%+d]", player_ptr->dis_ac, player_ptr->dis_to_a), TERM_L_BLUE);
+    display_player_one_line(ENTRY_BASE_AC, FormatBuffer("[%d,%+d]", player_ptr->dis_ac, player_ptr->dis_to_a), TERM_L_BLUE);
 
     int base_speed = player_ptr->pspeed - STANDARD_SPEED;
     if (player_ptr->action == ACTION_SEARCH) {
@@ -345,7 +345,7 @@ void display_player_middle(PlayerType *player_ptr)
     int tmp_speed = calc_temporary_speed(player_ptr);
     display_player_speed(player_ptr, attr, base_speed, tmp_speed);
     display_player_exp(player_ptr);
-    display_player_one_line(ENTRY_GOLD, format("%d", player_ptr->au), TERM_L_GREEN);
+    display_player_one_line(ENTRY_GOLD, FormatBuffer("%d", player_ptr->au), TERM_L_GREEN);
     display_playtime_in_game(player_ptr);
     display_real_playtime();
 }
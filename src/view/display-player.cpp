@@ -35,6 +35,7 @@
 #include "term/gameterm.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
+#include "term/z-form.h"
 #include "view/display-characteristic.h"
 #include "view/display-player-middle.h"
 #include "view/display-player-misc-info.h"
@@ -122,18 +123,18 @@ static void display_magic_realms(PlayerType *player_ptr)
 static void display_phisique(PlayerType *player_ptr)
 {
 #ifdef JP
-    display_player_one_line(ENTRY_AGE, format("%d才", (int)player_ptr->age), TERM_L_BLUE);
-    display_player_one_line(ENTRY_HEIGHT, format("%dcm", inch_to_cm(player_ptr->ht)), TERM_L_BLUE);
-    display_player_one_line(ENTRY_WEIGHT, format("%dkg", lb_to_kg(player_ptr->wt)), TERM_L_BLUE);
-    display_player_one_line(ENTRY_SOCIAL, format("%d  ", (int)player_ptr->sc), TERM_L_BLUE);
+    display_player_one_line(ENTRY_AGE, FormatBuffer("%d才", (int)player_ptr->age), TERM_L_BLUE);
+    display_player_one_line(ENTRY_HEIGHT, FormatBuffer("%dcm", inch_to_cm(player_ptr->ht)), TERM_L_BLUE);
+    display_player_one_line(ENTRY_WEIGHT, FormatBuffer("%dkg", lb_to_kg(player_ptr->wt)), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SOCIAL, FormatBuffer("%d  ", (int)player_ptr->sc), TERM_L_BLUE);
 #else
-    display_player_one_line(ENTRY_AGE, format("%d", (int)player_ptr->age), TERM_L_BLUE);
-    display_player_one_line(ENTRY_HEIGHT, format("%d", (int)player_ptr->ht), TERM_L_BLUE);
-    display_player_one_line(ENTRY_WEIGHT, format("%d", (int)player_ptr->wt), TERM_L_BLUE);
-    display_player_one_line(ENTRY_SOCIAL, format("%d", (int)player_ptr->sc), TERM_L_BLUE);
+    display_player_one_line(ENTRY_AGE, FormatBuffer("%d", (int)player_ptr->age), TERM_L_BLUE);
+    display_player_one_line(ENTRY_HEIGHT, FormatBuffer("%d", (int)player_ptr->ht), TERM_L_BLUE);
+    display_player_one_line(ENTRY_WEIGHT, FormatBuffer("%d", (int)player_ptr->wt), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SOCIAL, FormatBuffer("%d", (int)player_ptr->sc), TERM_L_BLUE);
 #endif
     std::string alg = PlayerAlignment(player_ptr).get_alignment_description();
-    display_player_one_line(ENTRY_ALIGN, format("%s", alg.data()), TERM_L_BLUE);
+    display_player_one_line(ENTRY_ALIGN, FormatBuffer("%s", alg.data()), TERM_L_BLUE);
 }
 
 /*!
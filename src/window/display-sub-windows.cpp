@@ -34,6 +34,7 @@
 #include "target/target-preparation.h"
 #include "term/gameterm.h"
 #include "term/screen-processor.h"
+#include "term/z-form.h"
 #include "timed-effect/player-hallucination.h"
 #include "timed-effect/player-stun.h"
 #include "timed-effect/timed-effects.h"
@@ -127,7 +128,6 @@ void fix_inventory(PlayerType *player_ptr)
  */
 static void print_monster_line(TERM_LEN x, TERM_LEN y, MonsterEntity *m_ptr, int n_same, int n_awake)
 {
-    std::string buf;
     MonsterRaceId r_idx = m_ptr->ap_r_idx;
     auto *r_ptr = &monraces_info[r_idx];
 
@@ -137,24 +137,21 @@ static void print_monster_line(TERM_LEN x, TERM_LEN y, MonsterEntity *m_ptr, int
         return;
     }
     if (r_ptr->kind_flags.has(MonsterKindType::UNIQUE)) {
-        buf = format(_("%3s(覚%2d)", "%3s(%2d)"), MonsterRace(r_idx).is_bounty(true) ? "  W" : "  U", n_awake);
+        term_addstr(-1, TERM_WHITE, FormatBuffer(_("%3s(覚%2d)", "%3s(%2d)"), MonsterRace(r_idx).is_bounty(true) ? "  W" : "  U", n_awake));
     } else {
-        buf = format(_("%3d(覚%2d)", "%3d(%2d)"), n_same, n_awake);
+        term_addstr(-1, TERM_WHITE, FormatBuffer(_("%3d(覚%2d)", "%3d(%2d)"), n_same, n_awake));
     }
-    term_addstr(-1, TERM_WHITE, buf);
 
     term_addstr(-1, TERM_WHITE, " ");
     term_add_bigch(r_ptr->x_attr, r_ptr->x_char);
 
     if (r_ptr->r_tkills && m_ptr->mflag2.has_not(MonsterConstantFlagType::KAGE)) {
-        buf = format(" %2d", (int)r_ptr->level);
+        term_addstr(-1, TERM_WHITE, FormatBuffer(" %2d", (int)r_ptr->level));
     } else {
-        buf = " ??";
+        term_addstr(-1, TERM_WHITE, " ??");
     }
 
-    term_addstr(-1, TERM_WHITE, buf);
-
-    term_addstr(-1, TERM_WHITE, format(" %s ", r_ptr->name.data()));
+    term_addstr(-1, TERM_WHITE, FormatBuffer(" %s ", r_ptr->name.data()));
 }
 
 /*!
@@ -410,7 +407,7 @@ void fix_message(void)
         [] {
             const auto &[wid, hgt] = term_get_size();
             for (short i = 0; i < hgt; i++) {
-                term_putstr(0, (hgt - 1) - i, -1, (byte)((i < now_message) ? TERM_WHITE : TERM_SLATE), *message_str(i));
+                term_putstr(0, (hgt - 1) - i, -1, (byte)((i < now_message) ? TERM_WHITE : TERM_SLATE), message_str(i));
                 TERM_LEN x, y;
                 term_locate(&x, &y);
                 term_erase(x, y);
@@ -645,7 +642,8 @@ static void display_found_item_list(PlayerType *player_ptr)
     // OM_FOUNDフラグが立っていない
     // ItemKindTypeがGOLD
     std::vector<ItemEntity *> found_item_list;
-    for (auto &item : floor_ptr->o_list) {
+    for (OBJECT_IDX i = 1; i < floor_ptr->o_max; i++) {
+        auto &item = floor_ptr->o_list[i];
         const auto is_item_to_display =
             item.is_valid() && (item.number > 0) &&
             item.marked.has(OmType::FOUND) && (item.bi_key.tval() != ItemKindType::GOLD);
@@ -655,8 +653,10 @@ static void display_found_item_list(PlayerType *player_ptr)
         }
     }
 
-    std::sort(
-        found_item_list.begin(), found_item_list.end(),
+    // 表示できるのは先頭の (hgt - 1) 行分だけなので、その分だけを整列する
+    const auto num_displayable = std::min<size_t>(found_item_list.size(), hgt - 1);
+    std::partial_sort(
+        found_item_list.begin(), found_item_list.begin() + num_displayable, found_item_list.end(),
         [player_ptr](ItemEntity *left, ItemEntity *right) -> bool {
             return object_sort_comp(player_ptr, left, left->get_price(), right);
         });
@@ -808,7 +808,7 @@ static void display_spell_list(PlayerType *player_ptr)
 
             const auto comment = mindcraft_info(player_ptr, use_mind, i);
             constexpr auto fmt = "  %c) %-30s%2d %4d %3d%%%s";
-            term_putstr(x, y + i + 1, -1, a, format(fmt, I2A(i), spell.name, spell.min_lev, spell.mana_cost, chance, comment.data()));
+            term_putstr(x, y + i + 1, -1, a, FormatBuffer(fmt, I2A(i), spell.name, spell.min_lev, spell.mana_cost, chance, comment.data()));
         }
 
         return;
@@ -848,7 +848,7 @@ static void display_spell_list(PlayerType *player_ptr)
             }
 
             m[j] = y + n;
-            term_putstr(x, m[j], -1, a, format("%c/%c) %-20.20s", I2A(n / 8), I2A(n % 8), name));
+            term_putstr(x, m[j], -1, a, FormatBuffer("%c/%c) %-20.20s", I2A(n / 8), I2A(n % 8), name));
             n++;
         }
     }
@@ -62,7 +62,7 @@ void print_title(PlayerType *player_ptr)
  */
 void print_level(PlayerType *player_ptr)
 {
-    const auto tmp = format("%5d", player_ptr->lev);
+    const FormatBuffer tmp("%5d", player_ptr->lev);
     if (player_ptr->lev >= player_ptr->max_plv) {
         put_str(_("レベル ", "LEVEL "), ROW_LEVEL, 0);
         c_put_str(TERM_L_GREEN, tmp, ROW_LEVEL, COL_LEVEL + 7);
@@ -110,7 +110,7 @@ void print_ac(PlayerType *player_ptr)
 {
     /* AC の表示方式を変更している */
     put_str(_(" ＡＣ(     )", "Cur AC "), ROW_AC, COL_AC);
-    c_put_str(TERM_L_GREEN, format("%5d", player_ptr->dis_ac + player_ptr->dis_to_a), ROW_AC, COL_AC + _(6, 7));
+    c_put_str(TERM_L_GREEN, FormatBuffer("%5d", player_ptr->dis_ac + player_ptr->dis_to_a), ROW_AC, COL_AC + _(6, 7));
 }
 
 /*!
@@ -128,10 +128,10 @@ void print_hp(PlayerType *player_ptr)
         color = TERM_RED;
     }
 
-    c_put_str(color, format("%4ld", (long int)player_ptr->chp), ROW_CURHP, COL_CURHP + 3);
+    c_put_str(color, FormatBuffer("%4ld", (long int)player_ptr->chp), ROW_CURHP, COL_CURHP + 3);
     put_str("/", ROW_CURHP, COL_CURHP + 7);
     color = TERM_L_GREEN;
-    c_put_str(color, format("%4ld", (long int)player_ptr->mhp), ROW_CURHP, COL_CURHP + 8);
+    c_put_str(color, FormatBuffer("%4ld", (long int)player_ptr->mhp), ROW_CURHP, COL_CURHP + 8);
 }
 
 /*!
@@ -153,10 +153,10 @@ void print_sp(PlayerType *player_ptr)
         color = TERM_RED;
     }
 
-    c_put_str(color, format("%4ld", (long int)player_ptr->csp), ROW_CURSP, COL_CURSP + 3);
+    c_put_str(color, FormatBuffer("%4ld", (long int)player_ptr->csp), ROW_CURSP, COL_CURSP + 3);
     put_str("/", ROW_CURSP, COL_CURSP + 7);
     color = TERM_L_GREEN;
-    c_put_str(color, format("%4ld", (long int)player_ptr->msp), ROW_CURSP, COL_CURSP + 8);
+    c_put_str(color, FormatBuffer("%4ld", (long int)player_ptr->msp), ROW_CURSP, COL_CURSP + 8);
 }
 
 /*!
@@ -166,7 +166,7 @@ void print_sp(PlayerType *player_ptr)
 void print_gold(PlayerType *player_ptr)
 {
     put_str(_("＄ ", "AU "), ROW_GOLD, COL_GOLD);
-    c_put_str(TERM_L_GREEN, format("%9ld", (long)player_ptr->au), ROW_GOLD, COL_GOLD + 3);
+    c_put_str(TERM_L_GREEN, FormatBuffer("%9ld", (long)player_ptr->au), ROW_GOLD, COL_GOLD + 3);
 }
 
 /*!
@@ -182,12 +182,12 @@ void print_depth(PlayerType *player_ptr)
 
     auto *floor_ptr = player_ptr->current_floor_ptr;
     if (!floor_ptr->dun_level) {
-        c_prt(attr, format("%7s", _("地上", "Surf.")), row_depth, col_depth);
+        c_prt(attr, FormatBuffer("%7s", _("地上", "Surf.")), row_depth, col_depth);
         return;
     }
 
     if (floor_ptr->is_in_quest() && !floor_ptr->dungeon_idx) {
-        c_prt(attr, format("%7s", _("地上", "Quest")), row_depth, col_depth);
+        c_prt(attr, FormatBuffer("%7s", _("地上", "Quest")), row_depth, col_depth);
         return;
     }
 
@@ -234,7 +234,7 @@ void print_depth(PlayerType *player_ptr)
         break; /* Boring place */
     }
 
-    c_prt(attr, format("%7s", depths.data()), row_depth, col_depth);
+    c_prt(attr, FormatBuffer("%7s", depths.data()), row_depth, col_depth);
 }
 
 /*!
@@ -288,9 +288,9 @@ static void print_health_monster_in_arena_for_wizard(PlayerType *player_ptr)
         if (MonsterRace(monster.r_idx).is_valid()) {
             const auto &monrace = monster.get_monrace();
             term_putstr(col - 2, row + row_offset, 2, monrace.x_attr,
-                format("%c", monrace.x_char));
-            term_putstr(col - 1, row + row_offset, 5, TERM_WHITE, format("%5d", monster.hp));
-            term_putstr(col + 5, row + row_offset, 6, TERM_WHITE, format("%5d", monster.max_maxhp));
+                FormatBuffer("%c", monrace.x_char));
+            term_putstr(col - 1, row + row_offset, 5, TERM_WHITE, FormatBuffer("%5d", monster.hp));
+            term_putstr(col + 5, row + row_offset, 6, TERM_WHITE, FormatBuffer("%5d", monster.max_maxhp));
         }
     }
 }
@@ -164,7 +164,7 @@ void print_state(PlayerType *player_ptr)
             text = format("  %2d", command_rep);
         }
 
-        c_put_str(attr, format("%5.5s", text.data()), ROW_STATE, COL_STATE);
+        c_put_str(attr, FormatBuffer("%5.5s", text.data()), ROW_STATE, COL_STATE);
         return;
     }
 
@@ -246,7 +246,7 @@ void print_state(PlayerType *player_ptr)
     }
     }
 
-    c_put_str(attr, format("%5.5s", text.data()), ROW_STATE, COL_STATE);
+    c_put_str(attr, FormatBuffer("%5.5s", text.data()), ROW_STATE, COL_STATE);
 }
 
 /*!
@@ -307,7 +307,7 @@ void print_speed(PlayerType *player_ptr)
         buf = _("乗馬中", "Riding");
     }
 
-    c_put_str(attr, format("%-9s", buf.data()), row_speed, col_speed);
+    c_put_str(attr, FormatBuffer("%-9s", buf.data()), row_speed, col_speed);
 }
 
 /*!
@@ -44,7 +44,7 @@
 /*!
  * @brief デバグコマンド一覧表
  * @details
- * 空き: A,B,E,I,J,k,K,L,M,q,Q,R,T,U,V,W,y,Y
+ * 空き: A,B,E,I,J,k,K,L,M,q,Q,R,U,V,W,y,Y
  */
 constexpr std::array debug_menu_table = {
     std::make_tuple('a', _("全状態回復", "Restore all status")),
@@ -74,6 +74,7 @@ constexpr std::array debug_menu_table = {
     std::make_tuple('s', _("フロア相当のモンスター生成", "Generate monster which be in target depth")),
     std::make_tuple('S', _("フロア相当のモンスター召喚", "Summon monster which be in target depth")),
     std::make_tuple('t', _("テレポート", "Teleport self")),
+    std::make_tuple('T', _("ターン処理時間の計測開始/結果表示", "Start/show turn profiling")),
     std::make_tuple('u', _("啓蒙(忍者以外)", "Wiz-lite all floor except Ninja")),
     std::make_tuple('w', _("啓蒙(忍者配慮)", "Wiz-lite all floor")),
     std::make_tuple('x', _("経験値を得る(指定可)", "Get experience")),
@@ -229,6 +230,9 @@ bool exe_cmd_debug(PlayerType *player_ptr, char cmd)
     case 't':
         teleport_player(player_ptr, 100, TELEPORT_SPONTANEOUS);
         return true;
+    case 'T':
+        wiz_toggle_turn_profiler(player_ptr);
+        return true;
     case 'u':
         for (int y = 0; y < player_ptr->current_floor_ptr->height; y++) {
             for (int x = 0; x < player_ptr->current_floor_ptr->width; x++) {
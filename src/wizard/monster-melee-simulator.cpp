@@ -0,0 +1,313 @@
+/*!
+ * @brief モンスター打撃のモンテカルロシミュレーションをCSVで出力する
+ * @details 全モンスター種族について、架空のプレイヤー (AC毎) に対する1ターン分の打撃ダメージ分布と、
+ * プレイヤーを倒すまでのターン数の分布を求める.
+ * 命中判定とAC軽減は実際の打撃処理 (check_hit_from_monster_to_player() / switch_monster_blow_to_player()) と同じ式を用いる.
+ * 爆発する打撃は死亡時の爆発 (on_dead_explosion()) のダメージとし、爆発したモンスターとの戦闘はそこで終える.
+ * ゲーム本体の乱数は複数スレッドから使えないため、スレッド毎に独立した Xoshiro128StarStar を用いる.
+ * 各ジョブの乱数は種族とACから決まるシードで初期化するため、スレッド数に依らず出力は同一になる.
+ * 属性打撃に対する耐性、朦朧・切り傷等の副次効果は考慮しない.
+ */
+
+#include "wizard/monster-melee-simulator.h"
+#include "io/files-util.h"
+#include "monster-attack/monster-attack-switcher.h"
+#include "monster-attack/monster-attack-table.h"
+#include "monster-race/monster-race.h"
+#include "system/angband-version.h"
+#include "system/monster-race-info.h"
+#include "term/z-form.h"
+#include "util/angband-files.h"
+#include "util/enum-converter.h"
+#include "util/rng-xoshiro.h"
+#include "wizard/spoiler-util.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr std::array<int, 5> SIMULATED_PLAYER_ACS = { { 0, 40, 80, 120, 160 } }; //!< シミュレーションする架空プレイヤーのAC
+constexpr auto SIMULATED_PLAYER_HP = 500; //!< シミュレーションする架空プレイヤーのHP
+constexpr auto NUM_TRIALS = 1000; //!< 1組(種族とAC)あたりの試行回数
+constexpr auto MAX_KILL_TURNS = 50; //!< 撃破までのターン数の打ち切り値
+constexpr uint32_t SIMULATION_SEED = 0x5eed1234;
+
+struct MeleeSimulationResult {
+    double damage_mean = 0.0;
+    int damage_p50 = 0;
+    int damage_p90 = 0;
+    int damage_p99 = 0;
+    int damage_max = 0;
+    int kill_turns_p10 = 0;
+    int kill_turns_p50 = 0;
+    int kill_turns_p90 = 0;
+};
+
+/*!
+ * @brief 1スレッド分のシミュレータ
+ */
+class MeleeSimulator {
+public:
+    MeleeSimulator() = default;
+
+    MeleeSimulationResult simulate(const MonsterRaceInfo &monrace, int ac, uint32_t seed);
+
+private:
+    Xoshiro128StarStar rng;
+
+    int rand_int0(int max)
+    {
+        if (max <= 1) {
+            return 0;
+        }
+
+        std::uniform_int_distribution<> d(0, max - 1);
+        return d(this->rng);
+    }
+
+    int rand_int1(int max)
+    {
+        return this->rand_int0(max) + 1;
+    }
+
+    int roll_dice(int num, int sides)
+    {
+        auto sum = 0;
+        for (auto i = 0; i < num; i++) {
+            sum += this->rand_int1(sides);
+        }
+
+        return sum;
+    }
+
+    bool check_hit(int power, int level, int ac);
+    int simulate_explosion(const MonsterBlow &blow);
+    int simulate_blow(int rlev, const MonsterBlow &blow, int ac);
+    int simulate_turn(const MonsterRaceInfo &monrace, int ac, bool &has_exploded);
+};
+
+/*!
+ * @brief モンスター打撃の命中判定 (check_hit_from_monster_to_player() と同一の式)
+ */
+bool MeleeSimulator::check_hit(int power, int level, int ac)
+{
+    const auto k = this->rand_int0(100);
+    if (k < 10) {
+        return k < 5;
+    }
+
+    const auto i = power + (level * 3);
+    return (i > 0) && (this->rand_int1(i) > ((ac * 3) / 4));
+}
+
+/*!
+ * @brief 爆発した打撃のダメージ (on_dead_explosion() の球が隣接するプレイヤーに及ぼすダメージに相当)
+ * @details 打撃そのもののダメージは0で、自爆したモンスターの死亡時の爆発 (半径3) でダメージを受ける.
+ * 爆心から距離1なので affect_player() と同じく (ダメージ + 1) / 2 となり、AC軽減はない.
+ */
+int MeleeSimulator::simulate_explosion(const MonsterBlow &blow)
+{
+    if (mbe_info[enum2i(blow.effect)].explode_type == AttributeType::NONE) {
+        return 0;
+    }
+
+    const auto damage = std::min(this->roll_dice(blow.d_dice, blow.d_side), 1600);
+    return (damage + 1) / 2;
+}
+
+/*!
+ * @brief 命中した1回の打撃のダメージ (switch_monster_blow_to_player() のダメージ計算部分に相当)
+ * @param rlev モンスターのレベル (最低1)
+ * @param blow 打撃への参照
+ * @param ac プレイヤーのAC
+ */
+int MeleeSimulator::simulate_blow(int rlev, const MonsterBlow &blow, int ac)
+{
+    if (blow.method == RaceBlowMethodType::EXPLODE) {
+        return this->simulate_explosion(blow);
+    }
+
+    if (blow.effect == RaceBlowEffectType::FLAVOR) {
+        return 0;
+    }
+
+    auto damage = this->roll_dice(blow.d_dice, blow.d_side);
+    switch (blow.effect) {
+    case RaceBlowEffectType::SUPERHURT:
+        if ((this->rand_int1(rlev * 2 + 300) > (ac + 200)) || (this->rand_int0(13) == 0)) {
+            damage = reduce_blow_damage_by_ac(damage, ac);
+            return std::max(damage, damage * 2);
+        }
+
+        return reduce_blow_damage_by_ac(damage, ac);
+    case RaceBlowEffectType::HURT:
+    case RaceBlowEffectType::SHATTER:
+        return reduce_blow_damage_by_ac(damage, ac);
+    default:
+        return damage;
+    }
+}
+
+/*!
+ * @brief 1ターン分の打撃のダメージ
+ * @param monrace モンスター種族への参照
+ * @param ac プレイヤーのAC
+ * @param has_exploded 爆発する打撃が命中してモンスターが死んだか (戻り値)
+ * @return ダメージの合計
+ * @details 爆発した時点でモンスターは死ぬため、以降の打撃は行わない.
+ */
+int MeleeSimulator::simulate_turn(const MonsterRaceInfo &monrace, int ac, bool &has_exploded)
+{
+    const auto rlev = std::max<int>(monrace.level, 1);
+    auto damage = 0;
+    for (const auto &blow : monrace.blows) {
+        if ((blow.method == RaceBlowMethodType::NONE) || (blow.effect == RaceBlowEffectType::NONE)) {
+            break;
+        }
+
+        if (blow.method == RaceBlowMethodType::SHOOT) {
+            continue;
+        }
+
+        if (blow.effect != RaceBlowEffectType::FLAVOR) {
+            const auto power = mbe_info[enum2i(blow.effect)].power;
+            if (!this->check_hit(power, rlev, ac)) {
+                continue;
+            }
+        }
+
+        damage += this->simulate_blow(rlev, blow, ac);
+        if (blow.method == RaceBlowMethodType::EXPLODE) {
+            has_exploded = true;
+            break;
+        }
+    }
+
+    return damage;
+}
+
+MeleeSimulationResult MeleeSimulator::simulate(const MonsterRaceInfo &monrace, int ac, uint32_t seed)
+{
+    this->rng.set_state(seed);
+    std::vector<int> damages;
+    std::vector<int> kill_turns;
+    damages.reserve(NUM_TRIALS);
+    kill_turns.reserve(NUM_TRIALS);
+    for (auto trial = 0; trial < NUM_TRIALS; trial++) {
+        auto total = 0;
+        auto turns = 0;
+        auto has_exploded = false;
+        while ((total < SIMULATED_PLAYER_HP) && (turns < MAX_KILL_TURNS) && !has_exploded) {
+            const auto damage = this->simulate_turn(monrace, ac, has_exploded);
+            if (turns == 0) {
+                damages.push_back(damage);
+            }
+
+            total += damage;
+            turns++;
+        }
+
+        kill_turns.push_back(turns);
+    }
+
+    std::sort(damages.begin(), damages.end());
+    std::sort(kill_turns.begin(), kill_turns.end());
+    const auto percentile = [](const std::vector<int> &sorted, int p) { return sorted[(sorted.size() - 1) * p / 100]; };
+    MeleeSimulationResult result;
+    auto sum = 0.0;
+    for (const auto damage : damages) {
+        sum += damage;
+    }
+
+    result.damage_mean = sum / damages.size();
+    result.damage_p50 = percentile(damages, 50);
+    result.damage_p90 = percentile(damages, 90);
+    result.damage_p99 = percentile(damages, 99);
+    result.damage_max = damages.back();
+    result.kill_turns_p10 = percentile(kill_turns, 10);
+    result.kill_turns_p50 = percentile(kill_turns, 50);
+    result.kill_turns_p90 = percentile(kill_turns, 90);
+    return result;
+}
+
+std::string escape_csv(std::string_view str)
+{
+    std::string escaped = "\"";
+    for (const auto c : str) {
+        if (c == '"') {
+            escaped.push_back('"');
+        }
+
+        escaped.push_back(c);
+    }
+
+    escaped.push_back('"');
+    return escaped;
+}
+}
+
+/*!
+ * @brief モンスター打撃のシミュレーション結果をCSVに出力する
+ * @return 出力結果
+ */
+SpoilerOutputResultType spoil_mon_melee_simulation()
+{
+    const auto &path = path_build(ANGBAND_DIR_USER, "mon-melee-sim.csv");
+    std::ofstream ofs(path);
+    if (!ofs) {
+        return SpoilerOutputResultType::FILE_OPEN_FAILED;
+    }
+
+    std::vector<const MonsterRaceInfo *> monraces;
+    for (const auto &[monrace_id, monrace] : monraces_info) {
+        if (MonsterRace(monrace_id).is_valid() && (monrace.blows[0].method != RaceBlowMethodType::NONE)) {
+            monraces.push_back(&monrace);
+        }
+    }
+
+    const auto num_jobs = monraces.size() * SIMULATED_PLAYER_ACS.size();
+    std::vector<MeleeSimulationResult> results(num_jobs);
+    std::atomic<size_t> next_job = 0;
+    const auto worker = [&]() {
+        MeleeSimulator simulator;
+        for (auto job = next_job++; job < num_jobs; job = next_job++) {
+            const auto &monrace = *monraces[job / SIMULATED_PLAYER_ACS.size()];
+            const auto ac = SIMULATED_PLAYER_ACS[job % SIMULATED_PLAYER_ACS.size()];
+            results[job] = simulator.simulate(monrace, ac, SIMULATION_SEED + static_cast<uint32_t>(job));
+        }
+    };
+
+    const auto num_threads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (auto i = 1U; i < num_threads; i++) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ofs << format("# Monster melee simulation for %s (player HP %d, %d trials)\n", get_version().data(), SIMULATED_PLAYER_HP, NUM_TRIALS);
+    ofs << "race_id,name,level,player_ac,damage_mean,damage_p50,damage_p90,damage_p99,damage_max,kill_turns_p10,kill_turns_p50,kill_turns_p90\n";
+    for (size_t job = 0; job < num_jobs; job++) {
+        const auto &monrace = *monraces[job / SIMULATED_PLAYER_ACS.size()];
+        const auto &result = results[job];
+#ifdef JP
+        const auto &name = monrace.E_name;
+#else
+        const auto &name = monrace.name;
+#endif
+        ofs << format("%d,%s,%d,%d,%.2f,%d,%d,%d,%d,%d,%d,%d\n", enum2i(monrace.idx), escape_csv(name).data(), monrace.level,
+            SIMULATED_PLAYER_ACS[job % SIMULATED_PLAYER_ACS.size()], result.damage_mean, result.damage_p50, result.damage_p90, result.damage_p99,
+            result.damage_max, result.kill_turns_p10, result.kill_turns_p50, result.kill_turns_p90);
+    }
+
+    return ofs.good() ? SpoilerOutputResultType::SUCCESSFUL : SpoilerOutputResultType::FILE_CLOSE_FAILED;
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+enum class SpoilerOutputResultType;
+SpoilerOutputResultType spoil_mon_melee_simulation();
@@ -18,6 +18,7 @@
 #include "cmd-io/cmd-save.h"
 #include "cmd-visual/cmd-draw.h"
 #include "core/asking-player.h"
+#include "core/show-file.h"
 #include "core/stuff-handler.h"
 #include "core/window-redrawer.h"
 #include "dungeon/quest.h"
@@ -88,6 +89,7 @@
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "system/terrain-type-definition.h"
+#include "system/turn-profiler.h"
 #include "target/grid-selector.h"
 #include "term/screen-processor.h"
 #include "term/z-form.h"
@@ -751,6 +753,31 @@ void wiz_dump_options(void)
     msg_format(_("オプションbit使用状況をファイル %s に書き出しました。", "Option bits usage dump saved to file %s."), filename.data());
 }
 
+/*!
+ * @brief ターン処理時間の計測を開始する、または計測を終えて結果を表示する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ */
+void wiz_toggle_turn_profiler(PlayerType *player_ptr)
+{
+    auto &profiler = TurnProfiler::get_instance();
+    if (!TurnProfiler::is_enabled()) {
+        profiler.start();
+        msg_print(_("ターン処理時間の計測を開始しました。", "Turn profiling started."));
+        return;
+    }
+
+    profiler.stop();
+    const auto &path = path_build(ANGBAND_DIR_USER, "turn-profile.txt");
+    const auto &filename = path.string();
+    if (!profiler.dump(path)) {
+        msg_format(_("ファイル %s を開けませんでした。", "Failed to open file %s."), filename.data());
+        msg_print(nullptr);
+        return;
+    }
+
+    (void)show_file(player_ptr, false, filename, 0, 0, _("ターン処理時間", "Turn profile"));
+}
+
 /*!
  * @brief プレイ日数を変更する / Set gametime.
  * @return 実際に変更を行ったらTRUEを返す
@@ -40,6 +40,7 @@
 #include "wizard/fixed-artifacts-spoiler.h"
 #include "wizard/items-spoiler.h"
 #include "wizard/monster-info-spoiler.h"
+#include "wizard/monster-melee-simulator.h"
 #include "wizard/spoiler-util.h"
 #include <algorithm>
 #include <array>
@@ -247,7 +248,8 @@ void exe_output_spoilers(void)
         prt("(5) Full Monster Info (mon-info.txt)", 9, 5);
         prt("(6) Monster Evolution Info (mon-evol.txt)", 10, 5);
         prt("(7) Player Spells Info (spells.txt)", 11, 5);
-        prt(_("コマンド:", "Command: "), _(18, 12), 0);
+        prt("(8) Monster Melee Simulation (mon-melee-sim.csv)", 12, 5);
+        prt(_("コマンド:", "Command: "), _(18, 13), 0);
         switch (inkey()) {
         case ESCAPE:
             screen_load();
@@ -273,6 +275,9 @@ void exe_output_spoilers(void)
         case '7':
             status = spoil_player_spell();
             break;
+        case '8':
+            status = spoil_mon_melee_simulation();
+            break;
         default:
             bell();
             break;
@@ -19,15 +19,30 @@
  * @param floo_ptr 現在フロアへの参照ポインタ
  * @return 開いているオブジェクト要素のID
  * @details
+ * 削除済の添字を優先して再利用し、配列の末尾を伸ばすのはその後とする.
+ * 空き添字の一覧は削除時に積まれるだけなので、取り出す時点で既に使われているか
+ * o_max の範囲外になっていれば読み捨てる.
  * This routine should almost never fail, but in case it does,
  * we must be sure to handle "failure" of this routine.
  */
 OBJECT_IDX o_pop(FloorType *floor_ptr)
 {
+    auto &free_list = floor_ptr->o_free_list;
+    while (!free_list.empty()) {
+        const auto i = free_list.back();
+        free_list.pop_back();
+        if ((i < floor_ptr->o_max) && !floor_ptr->o_list[i].is_valid()) {
+            floor_ptr->o_cnt++;
+            floor_ptr->invalidate_item_feeling(i);
+            return i;
+        }
+    }
+
     if (floor_ptr->o_max < w_ptr->max_o_idx) {
         OBJECT_IDX i = floor_ptr->o_max;
         floor_ptr->o_max++;
         floor_ptr->o_cnt++;
+        floor_ptr->invalidate_item_feeling(i);
         return i;
     }
 
@@ -37,6 +52,7 @@ OBJECT_IDX o_pop(FloorType *floor_ptr)
         }
 
         floor_ptr->o_cnt++;
+        floor_ptr->invalidate_item_feeling(i);
         return i;
     }
 
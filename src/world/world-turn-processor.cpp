@@ -37,6 +37,7 @@
 #include "system/monster-entity.h"
 #include "system/player-type-definition.h"
 #include "system/terrain-type-definition.h"
+#include "system/turn-profiler.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
 #include "util/bit-flags-calculator.h"
@@ -57,6 +58,7 @@ WorldTurnProcessor::WorldTurnProcessor(PlayerType *player_ptr)
  */
 void WorldTurnProcessor::process_world()
 {
+    TurnProfileScope profile_scope(TurnPhase::PROCESS_WORLD);
     const int a_day = TURNS_PER_TICK * TOWN_DAWN;
     const int prev_turn_in_today = ((w_ptr->game_turn - TURNS_PER_TICK) % a_day + a_day / 4) % a_day;
     const int prev_min = (1440 * prev_turn_in_today / a_day) % 60;